@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:09 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:09 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench.h
+ * @brief Microbenchmark harness for the parser, expansion and executor.
+ * 
+ * Each case is a function run in a loop: the number of iterations doubles
+ * until a batch lasts at least BENCH_MIN_NS, and the time per operation of
+ * that last batch is reported. The harness links the same objects as the
+ * shell (built by `make bench` with -O2 and without AddressSanitizer).
+ */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "minishell.h"
+# include <stdint.h>
+# include <stdio.h>
+
+# define BENCH_MIN_NS	200000000ULL
+# define BENCH_MAX_ITER	100000000UL
+
+typedef void	(*t_bench_fn)(void *arg);
+
+/**
+ * @brief Arguments shared by the benchmark cases.
+ */
+typedef struct s_bench_arg
+{
+	t_shell		*shell;
+	char		*input;
+	char		**tokens;
+	const char	*name;
+}	t_bench_arg;
+
+uint64_t	bench_now(void);
+void		bench_run(const char *name, t_bench_fn fn, void *arg);
+t_shell		*bench_make_shell(size_t env_count);
+void		bench_free_shell(t_shell *shell);
+char		*bench_repeat(const char *pattern, size_t count, const char *sep);
+void		bench_parser(void);
+void		bench_batch(void);
+void		bench_env(void);
+void		bench_exec(void);
+void		bench_redir(void);
+
+#endif
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_batch.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:02:26 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:02:26 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_batch.c
+ * @brief Benchmarks of multi-line input: one batch versus line by line.
+ * 
+ * Both cases lex and expand every line of a generated script. The batch
+ * case goes through tokenize_batch and expand_batch_line, the per-line
+ * case reproduces the previous path (strtok, strdup and tokenize_input for
+ * each line). tokenize_batch writes into its input, so both cases start
+ * from a fresh copy of the script.
+ */
+
+#include "bench.h"
+
+/**
+ * @brief Lexes the script as one batch and expands every line.
+ * 
+ * @param arg The benchmark arguments (tokens[0] is the scratch copy).
+ */
+static void	run_batch(void *arg)
+{
+	t_bench_arg	*bench;
+	t_batch		batch;
+	t_str_vec	line;
+	size_t		i;
+
+	bench = arg;
+	ft_strcpy(bench->tokens[0], bench->input);
+	if (!tokenize_batch(bench->tokens[0], &batch))
+		return ;
+	line.count = 0;
+	line.capacity = batch.max_count + 1;
+	line.items = malloc(line.capacity * sizeof(char *));
+	i = 0;
+	while (line.items && i < batch.line_count)
+	{
+		expand_batch_line(batch.tokens + batch.lines[i].first,
+			batch.lines[i].count, &line, bench->shell);
+		release_batch_line(batch.tokens + batch.lines[i].first,
+			batch.lines[i].count, &line);
+		i++;
+	}
+	free(line.items);
+	free_batch(&batch);
+}
+
+/**
+ * @brief Splits the script into lines, duplicating and tokenizing each.
+ * 
+ * @param arg The benchmark arguments (tokens[0] is the scratch copy).
+ */
+static void	run_per_line(void *arg)
+{
+	t_bench_arg	*bench;
+	char		*line;
+	char		*copy;
+	char		*saveptr;
+
+	bench = arg;
+	ft_strcpy(bench->tokens[0], bench->input);
+	line = ft_strtok_r(bench->tokens[0], "\n", &saveptr);
+	while (line)
+	{
+		copy = ft_strdup(line);
+		free_tokens_array(tokenize_input(copy, bench->shell), -1);
+		free(copy);
+		line = ft_strtok_r(NULL, "\n", &saveptr);
+	}
+}
+
+/**
+ * @brief Benchmarks both paths on a script of the given length.
+ * 
+ * @param shell The shell used for expansion.
+ * @param lines The number of lines of the script.
+ * @param batch_name The name of the batch case.
+ * @param line_name The name of the per-line case.
+ */
+static void	bench_batch_case(t_shell *shell, size_t lines,
+				const char *batch_name, const char *line_name)
+{
+	t_bench_arg	arg;
+	char		*scratch[1];
+
+	arg.shell = shell;
+	arg.input = bench_repeat("echo line%zu \"$HOME\" 'x' | cat > out",
+			lines, "\n");
+	scratch[0] = malloc(ft_strlen(arg.input) + 1);
+	arg.tokens = scratch;
+	if (scratch[0])
+	{
+		bench_run(batch_name, run_batch, &arg);
+		bench_run(line_name, run_per_line, &arg);
+	}
+	free(scratch[0]);
+	free(arg.input);
+}
+
+/**
+ * @brief Runs the multi-line input benchmarks.
+ */
+void	bench_batch(void)
+{
+	t_shell	*shell;
+
+	shell = bench_make_shell(16);
+	bench_batch_case(shell, 1000, "tokenize_batch/1000 lines",
+		"tokenize per line/1000 lines");
+	bench_batch_case(shell, 10000, "tokenize_batch/10000 lines",
+		"tokenize per line/10000 lines");
+	bench_free_shell(shell);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_env.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:33:27 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:33:27 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_env.c
+ * @brief Benchmarks of replace_env_variables and env_to_array.
+ */
+
+#include "bench.h"
+
+char	**env_to_array(t_env *env);
+
+/**
+ * @brief Expands the variables of a token once.
+ * 
+ * @param arg The benchmark arguments.
+ */
+static void	run_replace(void *arg)
+{
+	t_bench_arg	*bench;
+	char		*result;
+
+	bench = arg;
+	result = replace_env_variables(bench->input, bench->shell);
+	free(result);
+}
+
+/**
+ * @brief Converts the environment list to an array once.
+ * 
+ * @param arg The benchmark arguments.
+ */
+static void	run_env_to_array(void *arg)
+{
+	t_bench_arg	*bench;
+
+	bench = arg;
+	free_array(env_to_array(bench->shell->env));
+}
+
+/**
+ * @brief Benchmarks replace_env_variables with a large environment.
+ * 
+ * The token references variables spread evenly over the environment list,
+ * the last one being the deepest, so lookups cannot all hit the head.
+ * 
+ * @param env_count The number of variables in the environment.
+ * @param refs The number of references in the token.
+ * @param name The name of the case.
+ */
+static void	bench_replace_case(size_t env_count, size_t refs, const char *name)
+{
+	t_bench_arg			arg;
+	t_dynamic_buffer	token;
+	char				item[64];
+	size_t				i;
+	int					len;
+
+	arg.shell = bench_make_shell(env_count);
+	init_buffer(&token, MIN_BUFFER_SIZE);
+	i = 0;
+	while (i < refs)
+	{
+		len = snprintf(item, sizeof(item), "$BENCH_VAR_%zu text ",
+				env_count - 1 - i * (env_count / refs));
+		append_to_buffer(&token, item, len);
+		i++;
+	}
+	arg.input = token.data;
+	bench_run(name, run_replace, &arg);
+	free_buffer(&token);
+	bench_free_shell(arg.shell);
+}
+
+/**
+ * @brief Benchmarks env_to_array with a large environment.
+ * 
+ * @param env_count The number of variables in the environment.
+ * @param name The name of the case.
+ */
+static void	bench_env_array_case(size_t env_count, const char *name)
+{
+	t_bench_arg	arg;
+
+	arg.shell = bench_make_shell(env_count);
+	bench_run(name, run_env_to_array, &arg);
+	bench_free_shell(arg.shell);
+}
+
+/**
+ * @brief Runs the environment benchmarks.
+ */
+void	bench_env(void)
+{
+	bench_replace_case(100, 8, "replace_env_variables/100 vars x8");
+	bench_replace_case(1000, 8, "replace_env_variables/1000 vars x8");
+	bench_replace_case(1000, 64, "replace_env_variables/1000 vars x64");
+	bench_env_array_case(100, "env_to_array/100 vars");
+	bench_env_array_case(1000, "env_to_array/1000 vars");
+	bench_env_array_case(10000, "env_to_array/10000 vars");
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_exec.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:45:02 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:45:02 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_exec.c
+ * @brief Benchmark of search_in_path against a synthetic PATH.
+ */
+
+#include "bench.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#define BENCH_TARGET	"minishell_bench_target"
+
+/**
+ * @brief Resolves the target command once.
+ * 
+ * @param arg The benchmark arguments.
+ */
+static void	run_search(void *arg)
+{
+	t_bench_arg	*bench;
+
+	bench = arg;
+	free(search_in_path(bench->name, bench->shell->env));
+}
+
+/**
+ * @brief Creates the directories of the synthetic PATH.
+ * 
+ * Only the last directory contains the (executable) target, so every
+ * search walks the whole PATH.
+ * 
+ * @param root The temporary root directory.
+ * @param count The number of directories.
+ * @return The PATH value (to be freed).
+ */
+static char	*make_path_dirs(const char *root, size_t count)
+{
+	t_dynamic_buffer	path;
+	char				dir[PATH_MAX];
+	size_t				i;
+	int					fd;
+
+	init_buffer(&path, MIN_BUFFER_SIZE);
+	i = 0;
+	while (i < count)
+	{
+		snprintf(dir, sizeof(dir), "%s/d%zu", root, i);
+		mkdir(dir, 0755);
+		if (i > 0)
+			append_char_to_buffer(&path, ':');
+		append_to_buffer(&path, dir, ft_strlen(dir));
+		i++;
+	}
+	snprintf(dir, sizeof(dir), "%s/d%zu/" BENCH_TARGET, root, count - 1);
+	fd = open(dir, O_CREAT | O_WRONLY | O_TRUNC, 0755);
+	if (fd != -1)
+		close(fd);
+	return (path.data);
+}
+
+/**
+ * @brief Removes the directories of the synthetic PATH.
+ * 
+ * @param root The temporary root directory.
+ * @param count The number of directories.
+ */
+static void	remove_path_dirs(const char *root, size_t count)
+{
+	char	dir[PATH_MAX];
+	size_t	i;
+
+	snprintf(dir, sizeof(dir), "%s/d%zu/" BENCH_TARGET, root, count - 1);
+	unlink(dir);
+	i = 0;
+	while (i < count)
+	{
+		snprintf(dir, sizeof(dir), "%s/d%zu", root, i++);
+		rmdir(dir);
+	}
+	rmdir(root);
+}
+
+/**
+ * @brief Benchmarks search_in_path with a PATH of many directories.
+ * 
+ * @param dirs The number of directories in PATH.
+ * @param name The name of the case.
+ */
+static void	bench_search_case(size_t dirs, const char *name)
+{
+	t_bench_arg	arg;
+	char		root[64];
+	char		*path;
+
+	ft_strcpy(root, "/tmp/minishell_bench_XXXXXX");
+	if (!mkdtemp(root))
+		return (perror("mkdtemp"));
+	path = make_path_dirs(root, dirs);
+	arg.shell = bench_make_shell(16);
+	env_set_value(arg.shell->env, "PATH", path);
+	arg.name = BENCH_TARGET;
+	bench_run(name, run_search, &arg);
+	bench_free_shell(arg.shell);
+	free(path);
+	remove_path_dirs(root, dirs);
+}
+
+/**
+ * @brief Runs the executor benchmarks.
+ */
+void	bench_exec(void)
+{
+	bench_search_case(4, "search_in_path/4 dirs");
+	bench_search_case(32, "search_in_path/32 dirs");
+	bench_search_case(256, "search_in_path/256 dirs");
+}
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:50:18 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:50:18 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_main.c
+ * @brief Entry point of the microbenchmarks (`make bench`).
+ */
+
+#include "bench.h"
+
+/**
+ * @brief Runs every microbenchmark group.
+ * 
+ * @return 0.
+ */
+int	main(void)
+{
+	printf("%-40s %15s %17s\n", "case", "iterations", "time");
+	bench_parser();
+	bench_batch();
+	bench_env();
+	bench_exec();
+	bench_redir();
+	return (0);
+}
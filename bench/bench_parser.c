@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_parser.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:24:52 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:24:52 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_parser.c
+ * @brief Benchmarks of tokenize_input and build_ast.
+ */
+
+#include "bench.h"
+
+/**
+ * @brief Tokenizes (and expands) the input line once.
+ * 
+ * @param arg The benchmark arguments.
+ */
+static void	run_tokenize(void *arg)
+{
+	t_bench_arg	*bench;
+	char		**tokens;
+
+	bench = arg;
+	tokens = tokenize_input(bench->input, bench->shell);
+	free_tokens_array(tokens, -1);
+}
+
+/**
+ * @brief Builds and frees the AST of a token array once.
+ * 
+ * @param arg The benchmark arguments.
+ */
+static void	run_build_ast(void *arg)
+{
+	t_bench_arg	*bench;
+	t_ast		ast;
+
+	bench = arg;
+	ast.root = NULL;
+	build_ast(bench->tokens, &ast, bench->shell->env);
+	free_ast(&ast);
+}
+
+/**
+ * @brief Benchmarks tokenize_input on a generated pipeline.
+ * 
+ * Every segment mixes plain words, a double-quoted expansion, a
+ * single-quoted string and a redirection.
+ * 
+ * @param shell The shell used for expansion.
+ * @param segments The number of pipeline segments in the line.
+ * @param name The name of the case.
+ */
+static void	bench_tokenize_case(t_shell *shell, size_t segments,
+				const char *name)
+{
+	t_bench_arg	arg;
+
+	arg.shell = shell;
+	arg.input = bench_repeat("cmd%zu -x \"dq $HOME text\" 'sq $HOME' > out",
+			segments, " | ");
+	bench_run(name, run_tokenize, &arg);
+	free(arg.input);
+}
+
+/**
+ * @brief Benchmarks build_ast on a long pipeline.
+ * 
+ * @param shell The shell whose environment is given to the parser.
+ * @param stages The number of commands in the pipeline.
+ * @param name The name of the case.
+ */
+static void	bench_ast_case(t_shell *shell, size_t stages, const char *name)
+{
+	t_bench_arg	arg;
+
+	arg.shell = shell;
+	arg.input = bench_repeat("cmd%zu arg1 arg2", stages, " | ");
+	arg.tokens = tokenize_input(arg.input, shell);
+	bench_run(name, run_build_ast, &arg);
+	free_tokens_array(arg.tokens, -1);
+	free(arg.input);
+}
+
+/**
+ * @brief Runs the parser benchmarks.
+ */
+void	bench_parser(void)
+{
+	t_shell	*shell;
+
+	shell = bench_make_shell(16);
+	bench_tokenize_case(shell, 1, "tokenize_input/1 segment");
+	bench_tokenize_case(shell, 8, "tokenize_input/8 segments");
+	bench_tokenize_case(shell, 64, "tokenize_input/64 segments");
+	bench_ast_case(shell, 2, "build_ast/2 stages");
+	bench_ast_case(shell, 16, "build_ast/16 stages");
+	bench_ast_case(shell, 128, "build_ast/128 stages");
+	bench_free_shell(shell);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_redir.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_redir.c
+ * @brief Benchmarks of the redirection plans.
+ * 
+ * A command with N output redirections to /dev/null is parsed once. The
+ * compile case turns its redirection chain into a plan, the apply case
+ * applies that plan to the benchmark process and restores it, which is
+ * what a builtin with redirections costs on top of the builtin itself.
+ */
+
+#include "bench.h"
+
+/**
+ * @brief Compiles and frees the plan of the parsed chain.
+ * 
+ * @param arg The outermost redirection node.
+ */
+static void	run_compile(void *arg)
+{
+	t_redir_plan	*plan;
+
+	plan = compile_redir_plan(arg);
+	free_redir_plan(&plan);
+}
+
+/**
+ * @brief Applies the plan to the process and restores it.
+ * 
+ * @param arg The plan.
+ */
+static void	run_apply(void *arg)
+{
+	t_redir_plan	*plan;
+
+	plan = arg;
+	if (redir_plan_apply_saved(plan) == 0)
+		redir_plan_restore(plan, plan->count);
+}
+
+/**
+ * @brief Benchmarks a chain of the given number of redirections.
+ * 
+ * @param shell The shell used for tokenizing.
+ * @param count The number of redirections.
+ * @param compile_name The name of the compile case.
+ * @param apply_name The name of the apply case.
+ */
+static void	bench_redir_case(t_shell *shell, size_t count,
+				const char *compile_name, const char *apply_name)
+{
+	t_ast				ast;
+	t_redir_plan		*plan;
+	t_dynamic_buffer	input;
+	char				*redirs;
+	char				**tokens;
+
+	redirs = bench_repeat("> /dev/null", count, " ");
+	init_buffer(&input, MIN_BUFFER_SIZE);
+	append_to_buffer(&input, "true ", 5);
+	append_to_buffer(&input, redirs, ft_strlen(redirs));
+	tokens = tokenize_input(input.data, shell);
+	ast.root = NULL;
+	build_ast(tokens, &ast, shell->env);
+	plan = compile_redir_plan(ast.root);
+	if (plan)
+	{
+		bench_run(compile_name, run_compile, ast.root);
+		bench_run(apply_name, run_apply, plan);
+	}
+	free_redir_plan(&plan);
+	free_ast(&ast);
+	free_tokens_array(tokens, -1);
+	free_buffer(&input);
+	free(redirs);
+}
+
+/**
+ * @brief Runs the redirection plan benchmarks.
+ */
+void	bench_redir(void)
+{
+	t_shell	*shell;
+
+	shell = bench_make_shell(16);
+	bench_redir_case(shell, 1, "redir plan compile/1 redir",
+		"redir plan apply/1 redir");
+	bench_redir_case(shell, 8, "redir plan compile/8 redirs",
+		"redir plan apply/8 redirs");
+	bench_redir_case(shell, 64, "redir plan compile/64 redirs",
+		"redir plan apply/64 redirs");
+	bench_free_shell(shell);
+}
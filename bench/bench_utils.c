@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:11:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 13:11:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_utils.c
+ * @brief Timing loop and fixtures of the microbenchmarks.
+ */
+
+#include "bench.h"
+#include <time.h>
+
+/**
+ * @brief Reads the monotonic clock.
+ * 
+ * @return The current time in nanoseconds.
+ */
+uint64_t	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief Runs a benchmark case and prints its time per operation.
+ * 
+ * @param name The name of the case.
+ * @param fn The function to measure.
+ * @param arg The argument passed to the function.
+ */
+void	bench_run(const char *name, t_bench_fn fn, void *arg)
+{
+	size_t		iter;
+	size_t		i;
+	uint64_t	start;
+	uint64_t	elapsed;
+
+	fn(arg);
+	iter = 1;
+	elapsed = 0;
+	while (elapsed < BENCH_MIN_NS && iter < BENCH_MAX_ITER)
+	{
+		iter *= 2;
+		i = 0;
+		start = bench_now();
+		while (i++ < iter)
+			fn(arg);
+		elapsed = bench_now() - start;
+	}
+	printf("%-40s %10zu iter %14.1f ns/op\n", name, iter,
+		(double)elapsed / (double)iter);
+	fflush(stdout);
+}
+
+/**
+ * @brief Builds a shell whose environment has many variables.
+ * 
+ * Variables are named BENCH_VAR_<n> with the value value_<n>; PATH and HOME
+ * are copied from the real environment so path searches behave normally.
+ * 
+ * @param env_count The number of generated variables.
+ * @return The new shell.
+ */
+t_shell	*bench_make_shell(size_t env_count)
+{
+	t_shell	*shell;
+	char	key[32];
+	char	value[32];
+	size_t	i;
+
+	shell = safe_malloc(sizeof(t_shell));
+	ft_memset(shell, 0, sizeof(t_shell));
+	shell->env = env_create_node("HOME", getenv("HOME"));
+	env_append_node(&shell->env, "PATH", getenv("PATH"));
+	i = 0;
+	while (i < env_count)
+	{
+		snprintf(key, sizeof(key), "BENCH_VAR_%zu", i);
+		snprintf(value, sizeof(value), "value_%zu", i);
+		env_append_node(&shell->env, key, value);
+		i++;
+	}
+	return (shell);
+}
+
+/**
+ * @brief Releases a shell built by bench_make_shell().
+ * 
+ * @param shell The shell to free.
+ */
+void	bench_free_shell(t_shell *shell)
+{
+	free_env_list(shell->env);
+	free(shell);
+}
+
+/**
+ * @brief Repeats a pattern, formatting %zu with the repetition index.
+ * 
+ * @param pattern A printf pattern with one %zu conversion.
+ * @param count The number of repetitions.
+ * @param sep The separator put between repetitions.
+ * @return The generated string (to be freed).
+ */
+char	*bench_repeat(const char *pattern, size_t count, const char *sep)
+{
+	t_dynamic_buffer	buffer;
+	char				item[256];
+	size_t				i;
+	int					len;
+
+	init_buffer(&buffer, MIN_BUFFER_SIZE);
+	i = 0;
+	while (i < count)
+	{
+		if (i > 0)
+			append_to_buffer(&buffer, sep, ft_strlen(sep));
+		len = snprintf(item, sizeof(item), pattern, i);
+		append_to_buffer(&buffer, item, len);
+		i++;
+	}
+	return (buffer.data);
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+# End-to-end throughput benchmark of the script mode.
+#
+# usage: script_bench.sh <minishell binary> [runs]
+#
+# Runs bench/workload.msh <runs> times in a scratch directory and prints the
+# average wall time per run and the resulting command lines per second.
+
+set -e
+BIN=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+RUNS=${2:-20}
+HERE=$(cd "$(dirname "$0")" && pwd)
+WORKLOAD=$HERE/workload.msh
+SCRATCH=$(mktemp -d /tmp/minishell_bench.XXXXXX)
+trap 'rm -rf "$SCRATCH"' EXIT
+
+now_us() {
+	perl -MTime::HiRes=time -e 'printf "%.0f\n", time * 1000000'
+}
+
+LINES=$(grep -cv '^[[:space:]]*\(#\|$\)' "$WORKLOAD")
+cd "$SCRATCH"
+"$BIN" "$WORKLOAD" > /dev/null 2>&1 || true
+START=$(now_us)
+i=0
+while [ "$i" -lt "$RUNS" ]; do
+	"$BIN" "$WORKLOAD" > /dev/null 2>&1 || true
+	i=$((i + 1))
+done
+END=$(now_us)
+perl -e 'my ($l, $r, $us) = @ARGV;
+	printf "%-40s %10d runs %11.2f ms/run %9.0f lines/s\n",
+	"script_mode/workload.msh ($l lines)", $r, $us / $r / 1000,
+	$l * $r / ($us / 1000000);' "$LINES" "$RUNS" "$((END - START))"
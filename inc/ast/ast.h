@@ -60,12 +60,15 @@ typedef struct s_pipe
  * The type field indicates the type of redirection (input, output, etc.).
  * The file field contains the name of the file to redirect to.
  * The child field points to the command node that is being redirected.
+ * The fd field is the descriptor written before the operator (`2>`), or -1
+ * to use the default of the operator (0 for input, 1 for output).
  */
 typedef struct s_redirection
 {
 	t_redir_type	type;
 	char			*file;
 	t_ast_node		*child;
+	int				fd;
 }				t_redirection;
 
 /**
@@ -109,6 +112,9 @@ typedef union u_node_data
  * The next field points to the next node in the list.
  * The fd_in and fd_out fields are used for input and output file descriptors.
  * The is_pipe field indicates whether the node is part of a pipe.
+ * The redir_plan field holds the compiled redirections of a command node.
+ * The write_error field is set when the output of a builtin could not be
+ * written.
  */
 typedef struct s_ast_node
 {
@@ -119,6 +125,8 @@ typedef struct s_ast_node
 	int				fd_in;
 	int				fd_out;
 	bool			is_pipe;
+	t_redir_plan	*redir_plan;
+	bool			write_error;
 }				t_ast_node;
 
 /**
@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_cmd.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:07 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:41:07 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file arith_cmd.h
+ * @brief Arithmetic command header file.
+ * 
+ * This file contains the declarations of functions used for handling the
+ * `((expr))` command, which evaluates an arithmetic expression and sets
+ * the exit status from its value.
+ */
+
+#ifndef ARITH_CMD_H
+# define ARITH_CMD_H
+
+# include "types.h"
+# include "ast/ast.h"
+
+void	handle_arith_command(t_ast_node *node, t_shell *shell);
+
+#endif
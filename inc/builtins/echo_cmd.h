@@ -27,6 +27,6 @@
 # include "utils/str_utils.h"
 # include <unistd.h>
 
-void	handle_echo(t_ast_node *node, t_shell *shell);
+void	handle_echo(t_ast_node *node);
 
 #endif
@@ -29,5 +29,6 @@
 # include "ast/ast.h"
 
 void	handle_env(t_ast_node *node, t_env *env);
+void	list_shell_variables(t_ast_node *node, t_env *env);
 
 #endif
@@ -28,12 +28,13 @@
 char	*handle_quotes(char *arg);
 size_t	ft_strlcat(char *dst, const char *src, size_t dstsize);
 bool	is_valid_export_arg(const char *arg);
-char	*get_export_res(t_env *env);
+char	*get_export_res(t_env *env, int flag);
 char	*extract_var_name(const char *str, char **value);
 void	handle_export_output(t_ast_node *node, char *export_result);
-void	print_export_error(char *arg, t_shell *shell);
+void	print_export_error(char *arg, t_shell *shell, int flag);
 char	*process_export_value(char *value);
-void	update_environment(t_ast_node *node, t_shell *shell,
-			char *var_name, char *value);
+void	update_environment(t_shell *shell, char *var_name, char *value,
+			int flag);
+void	declare_arg(char *arg, t_shell *shell, int flag);
 
 #endif
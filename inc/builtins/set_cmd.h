@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set_cmd.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:20:05 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file set_cmd.h
+ * @brief Set command header file.
+ * 
+ * This file contains the declarations of functions used for handling the
+ * set command, which turns the shell options on and off.
+ */
+
+#ifndef SET_CMD_H
+# define SET_CMD_H
+
+# include "types.h"
+# include "ast/ast.h"
+
+void	handle_set(t_ast_node *node, t_shell *shell);
+
+#endif
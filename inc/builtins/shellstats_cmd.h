@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shellstats_cmd.h                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:47:20 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:47:20 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file shellstats_cmd.h
+ * @brief Shellstats command header file.
+ * 
+ * This file contains the declarations of functions used for handling the
+ * shellstats command, which prints the latency histograms collected by the
+ * self-profiling mode (see core/profile.h). `shellstats -r` clears them.
+ */
+
+#ifndef SHELLSTATS_CMD_H
+# define SHELLSTATS_CMD_H
+
+# include "types.h"
+# include "ast/ast.h"
+
+void	handle_shellstats(t_ast_node *node, t_shell *shell);
+
+#endif
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:02:11 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:02:11 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file arena.h
+ * @brief Bump allocator for data that is freed all at once.
+ */
+
+#ifndef ARENA_H
+# define ARENA_H
+
+# include "types.h"
+
+# define ARENA_BLOCK_SIZE	4096
+# define ARENA_ALIGN		16
+
+void	arena_init(t_arena *arena, size_t block_size);
+void	*arena_alloc(t_arena *arena, size_t size);
+char	*arena_strndup(t_arena *arena, const char *s, size_t len);
+void	arena_free(t_arena *arena);
+
+#endif
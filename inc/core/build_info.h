@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   build_info.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file build_info.h
+ * @brief Build profile the binary was compiled with.
+ * 
+ * The Makefile defines MS_BUILD_PROFILE (debug, release, pgo-gen or pgo) and
+ * MS_BUILD_FLAGS (the profile-specific compiler flags) so that a deployed
+ * binary can report how it was built with `minishell --build-info`.
+ */
+
+#ifndef BUILD_INFO_H
+# define BUILD_INFO_H
+
+# define BUILD_INFO_FLAG	"--build-info"
+
+# ifndef MS_BUILD_PROFILE
+#  define MS_BUILD_PROFILE	"unknown"
+# endif
+
+# ifndef MS_BUILD_FLAGS
+#  define MS_BUILD_FLAGS	""
+# endif
+
+/* GCC defines __SANITIZE_ADDRESS__, clang uses __has_feature */
+# if defined(__SANITIZE_ADDRESS__)
+#  define MS_BUILD_ASAN	1
+# elif defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+#   define MS_BUILD_ASAN	1
+#  endif
+# endif
+
+# ifndef MS_BUILD_ASAN
+#  define MS_BUILD_ASAN	0
+# endif
+
+void	print_build_info(int fd);
+
+#endif
@@ -21,5 +21,9 @@
 # include "minishell.h"
 
 bool	receive_input(t_shell *shell);
+void	run_input(char *input, t_shell *shell);
+void	run_script(const char *path, t_shell *shell);
+size_t	collect_heredoc_bodies(t_batch *batch, size_t line, t_shell *shell);
+void	release_heredoc_bodies(t_shell *shell);
 
 #endif
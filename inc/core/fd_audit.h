@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_audit.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:48:10 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:48:10 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file fd_audit.h
+ * @brief Debug check that a command line leaves no descriptor open.
+ * 
+ * Built in with `make debug` (MS_FD_AUDIT). The descriptors open in the
+ * shell are recorded before each command line and compared afterwards;
+ * any descriptor left open by the line is reported on standard error with
+ * both lists.
+ */
+
+#ifndef FD_AUDIT_H
+# define FD_AUDIT_H
+
+# include <stdbool.h>
+
+# ifndef MS_FD_AUDIT
+#  define MS_FD_AUDIT	0
+# endif
+
+/* Descriptors above this limit are not tracked */
+# define FD_AUDIT_MAX	1024
+
+/**
+ * @brief Open descriptors of the shell at one point in time.
+ * 
+ * Bit n of open is set when descriptor n is open.
+ */
+typedef struct s_fd_audit
+{
+	unsigned char	open[FD_AUDIT_MAX / 8];
+}				t_fd_audit;
+
+void	fd_audit_snapshot(t_fd_audit *audit);
+void	fd_audit_report(const t_fd_audit *before, char **tokens);
+
+#endif
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:37 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:37 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile.h
+ * @brief Opt-in self-profiling of the shell phases.
+ * 
+ * When MINISHELL_PROFILE is set in the environment (to anything but "0") or
+ * the shell is started with --profile, every phase between reading a line
+ * and the first execve is timestamped with CLOCK_MONOTONIC and recorded into
+ * a log-linear (HDR-style) latency histogram. The histograms live in a
+ * shared anonymous mapping, so the phases that run in forked children
+ * (env_to_array, path resolution, fork-to-exec) are aggregated as well.
+ * They are printed by the `shellstats` builtin and on exit.
+ */
+
+#ifndef PROFILE_H
+# define PROFILE_H
+
+# include "types.h"
+# include <stdint.h>
+# include <sys/types.h>
+
+# define PROF_ENV_VAR		"MINISHELL_PROFILE"
+# define PROF_FLAG			"--profile"
+
+/* 16 linear sub-buckets per power of two: ~6% relative precision */
+# define PROF_SUB_BITS		4
+# define PROF_SUB_COUNT		16
+# define PROF_BUCKETS		1024
+# define PROF_MAX_CHILDREN	64
+
+/**
+ * @brief Measured phases, in pipeline order.
+ * 
+ * PROF_SPAWN goes from fork() to the execve() call in the child and
+ * PROF_CHILD from fork() to the moment the child is reaped, so the shell
+ * overhead can be compared with the time spent in the child itself.
+ */
+typedef enum e_prof_phase
+{
+	PROF_VALIDATE,
+	PROF_TOKENIZE,
+	PROF_EXPAND,
+	PROF_BUILD_AST,
+	PROF_GEN_COMMAND,
+	PROF_ENV_ARRAY,
+	PROF_RESOLVE_PATH,
+	PROF_SPAWN,
+	PROF_CHILD,
+	PROF_PHASE_COUNT
+}	t_prof_phase;
+
+/**
+ * @brief Latency histogram of a phase, values in nanoseconds.
+ */
+typedef struct s_prof_hist
+{
+	uint64_t	count;
+	uint64_t	sum;
+	uint64_t	min;
+	uint64_t	max;
+	uint64_t	buckets[PROF_BUCKETS];
+}	t_prof_hist;
+
+/**
+ * @brief A forked child waiting to be reaped, for PROF_CHILD.
+ */
+typedef struct s_prof_child
+{
+	pid_t		pid;
+	uint64_t	start;
+}	t_prof_child;
+
+typedef struct s_prof_table
+{
+	pid_t			owner;
+	t_prof_hist		phases[PROF_PHASE_COUNT];
+	t_prof_child	children[PROF_MAX_CHILDREN];
+}	t_prof_table;
+
+t_prof_table	**prof_instance(void);
+void			prof_init(bool force, t_env *env);
+uint64_t		prof_start(void);
+void			prof_stop(t_prof_phase phase, uint64_t start);
+void			prof_record(t_prof_phase phase, uint64_t value);
+void			prof_reset(void);
+size_t			prof_bucket_index(uint64_t value);
+uint64_t		prof_bucket_value(size_t index);
+uint64_t		prof_percentile(t_prof_hist *hist, unsigned int percent);
+void			prof_child_spawned(pid_t pid, uint64_t start);
+void			prof_child_reaped(pid_t pid);
+bool			prof_render(t_dynamic_buffer *buffer);
+void			prof_dump_at_exit(void);
+
+#endif
@@ -27,6 +27,8 @@
 // Environment initialization
 # define INITIAL_BUFFER_SIZE	1024
 # define BUFFER_INCREMENT	512
+# define ENV_INTERN_BUCKETS	256
+# define SPECIAL_PARAMS		"?$!#0-"
 # define DEFAULT_PATH "/bin:/sbin:/usr/bin:/usr/sbin:/usr/local/bin\
 :/usr/local/sbin:/opt/bin:/opt/sbin"
 
@@ -45,6 +47,34 @@ typedef struct s_quote_state
 	bool	in_double_quotes;
 }				t_quote_state;
 
+/**
+ * @brief Header of a shared string of the environment.
+ * 
+ * Names and values of variables are allocated with this header in front
+ * of their characters, and the `char *` kept in a t_env points right after
+ * it. refs counts the holders of the string, which is freed by the last
+ * one. Names are also interned: a table keeps one string per name, linked
+ * through next, so that every node of that variable shares it.
+ */
+typedef struct s_env_str
+{
+	struct s_env_str	*next;
+	int					refs;
+	bool				interned;
+}				t_env_str;
+
+/**
+ * @brief Home directory of a user, kept for tilde expansion.
+ * 
+ * dir is NULL for a user that does not exist or has no home directory.
+ */
+typedef struct s_home
+{
+	char			*user;
+	char			*dir;
+	struct s_home	*next;
+}				t_home;
+
 /**
  * @brief Structure to represent the context of variable expansion.
  * 
@@ -75,18 +105,28 @@ t_env				*create_default_env(void);
 void				free_env_list(t_env *head);
 void				append_to_list(t_env *head, t_env *new_node);
 bool				update_if_duplicate(t_env *head, const char *key,
-						const char *value, t_env *new_node);
+						const char *value);
 bool				allocate_key(const char *env, size_t length, char **key);
 bool				allocate_value(const char *value_start, char **value);
 
 // Environment Variable Access and Manipulation
 t_env				*find_env_variable(t_env *env, const char *key);
 char				*get_env_value(const char *key, t_env *env);
+bool				env_is_readonly(t_env *env, const char *key);
 void				env_set_value(t_env *env, const char *key,
 						const char *value);
+void				env_set_shared(t_env *env, const char *key, char *value);
 int					safe_setenv(t_env **env, const char *name,
 						const char *value, int overwrite);
 
+// Shell variables and attributes
+size_t				env_assignment_len(const char *word);
+bool				env_readonly(t_env *env, const char *name);
+bool				env_assign(t_env **env, const char *name,
+						const char *value, int flags);
+bool				env_assign_word(t_env **env, const char *word, int flags);
+void				env_restore(t_env **env, t_env *old, const char *name);
+
 // Environment String Parsing and Validation
 bool				is_valid_env_name(const char *name);
 char				*get_env_name(const char *var);
@@ -94,6 +134,11 @@ char				*get_env_value_from_str(const char *var);
 
 // Variable Expansion and Special Handling
 char				*replace_env_variables(const char *token, t_shell *shell);
+char				*expand_marked(const char *token, t_shell *shell,
+						t_dynamic_buffer *mask);
+char				*tilde_prefix(const char *token, t_shell *shell,
+						size_t *len);
+char				*word_expand(const char *token, t_shell *shell);
 void				init_expansion_context(t_expansion_ctx *ctx,
 						const char *str, char *dest, t_env *env);
 
@@ -112,9 +157,29 @@ void				handle_double_quotes(t_token_context *ctx,
 						t_dynamic_buffer *buffer);
 void				handle_env_variable(t_token_context *ctx,
 						t_dynamic_buffer *buffer);
+void				expand_command_subst(t_token_context *ctx,
+						t_dynamic_buffer *buffer);
+void				expand_special_param(t_token_context *ctx,
+						t_dynamic_buffer *buffer);
+bool				is_special_param(char c);
+const char			*special_param(t_shell *shell, char name, char *out);
 
 //Env node utils
 void				free_env_node(t_env *node);
 t_env				*initialize_env_node(const char *key, const char *value);
+t_env				*env_node_share(const t_env *node);
+
+// Shared and interned strings
+char				*env_str_new(const char *s);
+char				*env_str_ref(char *s);
+void				env_str_release(char *s);
+void				env_str_set(char **slot, char *s);
+char				*env_intern(const char *name);
+char				*env_intern_find(const char *name);
+void				env_intern_remove(char *name);
+
+// Copy-on-write snapshots
+t_env				*env_snapshot(t_env *env);
+t_env				*env_own(t_env *head, const char *key);
 
 #endif
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:20:44 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:20:44 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith.h
+ * @brief In-process evaluation of arithmetic expressions.
+ * 
+ * Used by `$((expr))` and `((expr))`. Values are 64-bit signed integers
+ * that wrap around on overflow, like in bash. Variables are read from the
+ * environment list, where an unset or empty variable is 0, and assignments
+ * write to it. The grammar is parsed by precedence climbing.
+ */
+
+#ifndef ENV_ARITH_H
+# define ENV_ARITH_H
+
+# include "types.h"
+# include <stdint.h>
+
+/* Nesting (parentheses, unary operators, variables) before giving up */
+# define ARITH_MAX_DEPTH	1024
+/* Room for the decimal form of any int64_t and its NUL */
+# define ARITH_NUM_SIZE		21
+
+/**
+ * @brief Binary operators, from the lowest precedence to the highest.
+ */
+typedef enum e_arith_op
+{
+	ARITH_NONE,
+	ARITH_LOR,
+	ARITH_LAND,
+	ARITH_BOR,
+	ARITH_BXOR,
+	ARITH_BAND,
+	ARITH_EQ,
+	ARITH_NE,
+	ARITH_LT,
+	ARITH_LE,
+	ARITH_GT,
+	ARITH_GE,
+	ARITH_SHL,
+	ARITH_SHR,
+	ARITH_ADD,
+	ARITH_SUB,
+	ARITH_MUL,
+	ARITH_DIV,
+	ARITH_MOD,
+	ARITH_POW
+}			t_arith_op;
+
+/**
+ * @brief State of one evaluation.
+ * 
+ * skip is non-zero in the branch of `&&`, `||` or `?:` that is not taken:
+ * it is parsed, but assigns nothing and cannot fail on a division by 0.
+ * error and error_at describe the first error.
+ */
+typedef struct s_arith
+{
+	const char	*expr;
+	const char	*ptr;
+	t_shell		*shell;
+	const char	*error;
+	const char	*error_at;
+	int			skip;
+	int			depth;
+}				t_arith;
+
+bool		arith_eval(const char *expr, t_shell *shell, int64_t *value);
+bool		arith_fail(t_arith *a, const char *message);
+void		arith_skip_spaces(t_arith *a);
+size_t		arith_format(int64_t value, char *out);
+bool		arith_comma(t_arith *a, int64_t *value);
+bool		arith_assign(t_arith *a, int64_t *value);
+bool		arith_unary(t_arith *a, int64_t *value);
+bool		arith_operand(t_arith *a, int64_t *value);
+size_t		arith_name_len(const char *s);
+bool		arith_load(t_arith *a, const char *name, size_t len,
+				int64_t *value);
+bool		arith_store(t_arith *a, const char *name, size_t len,
+				int64_t value);
+t_arith_op	arith_binary_op(const char *s, size_t *len);
+bool		arith_assign_op(const char *s, size_t *len, t_arith_op *op);
+int			arith_precedence(t_arith_op op);
+bool		arith_apply(t_arith *a, t_arith_op op, int64_t *left,
+				int64_t right);
+
+#endif
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:03:26 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 19:03:26 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_brace.h
+ * @brief Brace expansion (`{a,b}`, `{1..10}`, `{a..z..2}`).
+ * 
+ * Runs on the words of a command line, right before the pathname
+ * expansion, and generates each word of a group straight into the new
+ * words of the line.
+ */
+
+#ifndef ENV_BRACE_H
+# define ENV_BRACE_H
+
+# include <stdbool.h>
+# include <stddef.h>
+# include "env/env_glob.h"
+
+/* Longest number a range accepts, in digits, so that no step overflows */
+# define BRACE_MAX_DIGITS	18
+
+/**
+ * @brief The first brace group of a word.
+ * 
+ * open and close are the indexes of its braces. For a range, from, to
+ * and step describe it: step is already signed in the direction of the
+ * range, is_char is set for a letter range and width is the width of the
+ * zero-padded numbers (0 when they are not padded).
+ */
+typedef struct s_brace
+{
+	size_t	open;
+	size_t	close;
+	bool	is_range;
+	bool	is_char;
+	long	from;
+	long	to;
+	long	step;
+	int		width;
+}			t_brace;
+
+bool		brace_find(const char *s, t_brace *b);
+bool		brace_expand(char *word, t_str_vec *out);
+bool		brace_range_parse(const char *s, size_t len, t_brace *b);
+char		*brace_splice(const char *word, t_brace *b, const char *mid,
+				size_t len);
+bool		brace_range(char *word, t_brace *b, t_str_vec *out);
+
+#endif
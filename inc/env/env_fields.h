@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_fields.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 15:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_fields.h
+ * @brief Field splitting of the words of a command.
+ * 
+ * Runs with the expansion of a word: the bytes that an unquoted expansion
+ * (`$VAR`, `$?`, `$(...)`, `${...}`) puts in the word are split on the
+ * characters of IFS, while its quoted and literal bytes never are. Each
+ * field goes straight into the words of the line, which the parser then
+ * takes as the arguments of the command.
+ */
+
+#ifndef ENV_FIELDS_H
+# define ENV_FIELDS_H
+
+# include <stdbool.h>
+# include <stddef.h>
+# include "types.h"
+# include "env/env_glob.h"
+
+/* Value of IFS when it is not set */
+# define IFS_DEFAULT	" \t\n"
+
+/**
+ * @brief A word being split into fields.
+ * 
+ * origin holds one mark per byte of the word from quoted on: '1' for a
+ * byte of an unquoted expansion, whose quotes are literal, '2' for the
+ * text of a `${name:-word}` operand, whose quotes are shell quotes. The
+ * quoted first bytes (an expanded tilde prefix) and the bytes past
+ * origin_len are never split, nor are the bytes between quotes: quote is
+ * the quote the split is in, if any.
+ */
+typedef struct s_fields
+{
+	const char	*word;
+	const char	*origin;
+	size_t		origin_len;
+	size_t		quoted;
+	const char	*ifs;
+	char		quote;
+	t_str_vec	*out;
+}				t_fields;
+
+bool	split_fields(t_fields *f);
+bool	word_fields(const char *token, t_shell *shell, t_str_vec *out);
+bool	word_splits(char **tokens, size_t i);
+
+#endif
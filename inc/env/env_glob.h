@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:40:21 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:40:21 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob.h
+ * @brief Pathname expansion (globbing).
+ * 
+ * Runs after variable expansion, on the words of a whole command line.
+ * The directories read while expanding a line are cached until the line
+ * is expanded, so several patterns against the same directory read it
+ * once.
+ */
+
+#ifndef ENV_GLOB_H
+# define ENV_GLOB_H
+
+# include <stdbool.h>
+# include <stddef.h>
+
+/* Characters that make a file name quoted when it replaces a pattern */
+# define GLOB_QUOTE_CHARS	"'\"\\<>|() \t\n"
+
+/**
+ * @brief How a word of the line is globbed.
+ * 
+ * GLOB_SKIP: not at all (operators, heredoc delimiters, `((expr))`...).
+ * GLOB_ALL: replaced by all its matches.
+ * GLOB_ONE: a redirection target, replaced by its match only if there is
+ * exactly one.
+ */
+typedef enum e_glob_mode
+{
+	GLOB_SKIP,
+	GLOB_ALL,
+	GLOB_ONE
+}			t_glob_mode;
+
+/**
+ * @brief A growable, NULL-terminated array of strings.
+ */
+typedef struct s_str_vec
+{
+	char	**items;
+	size_t	count;
+	size_t	capacity;
+}			t_str_vec;
+
+/**
+ * @brief A directory read once for the current line.
+ * 
+ * Each entry is stored as its d_type byte followed by its name, so that
+ * the type is known without a stat. `.` and `..` are left out.
+ */
+typedef struct s_glob_dir
+{
+	char				*path;
+	t_str_vec			entries;
+	struct s_glob_dir	*next;
+}						t_glob_dir;
+
+/**
+ * @brief State of the expansion of a line: the directory cache, the
+ * brace expansion of the current word and the matches of the current
+ * pattern.
+ */
+typedef struct s_glob
+{
+	t_glob_dir	*cache;
+	t_str_vec	words;
+	t_str_vec	matches;
+}				t_glob;
+
+char		**expand_globs(char **tokens);
+void		adopt_glob_words(char ***tokens, size_t *count);
+bool		glob_emit(t_glob *g, t_str_vec *out, char *word, t_glob_mode mode);
+bool		glob_walk(t_glob *g, const char *path, const char *pattern);
+t_glob_dir	*glob_dir_get(t_glob *g, const char *path);
+void		free_glob(t_glob *g);
+bool		glob_entry_is_dir(const char *entry, const char *path);
+int			glob_compare(const void *a, const void *b);
+bool		str_vec_push(t_str_vec *vec, char *s);
+char		*glob_quote(const char *name);
+bool		pattern_has_glob(const char *pattern, size_t len);
+char		*glob_join(const char *a, const char *b, const char *c);
+
+#endif
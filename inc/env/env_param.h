@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:21:09 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:21:09 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_param.h
+ * @brief Braced parameter expansion (`${name}`, `${name:-word}`...).
+ */
+
+#ifndef ENV_PARAM_H
+# define ENV_PARAM_H
+
+# include "types.h"
+# include "env/env_arith.h"
+# include "core/dynamic_buffer.h"
+
+/**
+ * @brief A parsed `${...}`.
+ * 
+ * value is NULL for an unset parameter; status holds the text of a
+ * special parameter (`$?`, `$$`...).
+ * op is the operator: '\0' for none, one of `-=?+` (colon set for the
+ * `:-` forms, which also treat an empty value as unset), ':' for a
+ * substring, '#' or '%' for a prefix or suffix removal (longest set for
+ * `##` and `%%`). word is the text after the operator, not yet expanded.
+ */
+typedef struct s_param
+{
+	char		*name;
+	const char	*value;
+	char		status[ARITH_NUM_SIZE];
+	char		op;
+	bool		colon;
+	bool		longest;
+	const char	*word;
+}				t_param;
+
+void	expand_param_subst(t_token_context *ctx, t_dynamic_buffer *buffer);
+void	param_failed(t_token_context *ctx);
+void	param_lookup(t_param *p, t_shell *shell);
+char	*param_word(t_token_context *ctx, const char *word);
+char	*param_operand(t_token_context *ctx, t_dynamic_buffer *buffer,
+			t_param *p);
+void	param_default(t_token_context *ctx, t_dynamic_buffer *buffer,
+			t_param *p);
+void	param_substring(t_token_context *ctx, t_dynamic_buffer *buffer,
+			t_param *p);
+void	param_trim(t_token_context *ctx, t_dynamic_buffer *buffer,
+			t_param *p);
+
+#endif
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsub.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:05:26 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:05:26 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file cmdsub.h
+ * @brief Output capture of command substitutions, `$(list)`.
+ */
+
+#ifndef CMDSUB_H
+# define CMDSUB_H
+
+# include "types.h"
+
+/* Initial capacity of the capture buffer */
+# define CMDSUB_BUFFER_SIZE		65536
+/* Output size from which the capture switches to its large-output path */
+# define CMDSUB_LARGE_OUTPUT	16384
+/* Pipe size requested for a large output (Linux, F_SETPIPE_SZ) */
+# define CMDSUB_PIPE_SIZE		1048576
+
+bool	capture_command(const char *list, size_t len, t_shell *shell,
+			t_dynamic_buffer *out);
+
+#endif
@@ -16,6 +16,7 @@
 # include "types.h"
 
 # include <fcntl.h>
+# include <stdint.h>
 # include <sys/wait.h>
 
 # ifndef EXEC_BUFFER_SIZE 
@@ -34,19 +35,12 @@ typedef struct s_cmd_data
 	t_command	command;
 	t_pipe_data	data;
 	pid_t		pid;
+	uint64_t	spawn;
 	int			ret;
 	void		(*old_sigint)(int);
 	void		(*old_sigquit)(int);
 }	t_cmd_data;
 
-typedef struct s_cmd_context
-{
-	t_ast_node	*cmd;
-	t_ast_node	*right_node;
-	int			last_input_fd;
-	int			left_fd;
-}	t_cmd_context;
-
 typedef struct s_more_data
 {
 	int		pipe_fd[2];
@@ -57,7 +51,6 @@ typedef struct s_more_data
 }			t_more_data;
 
 void		execute_ast(t_ast *ast, t_shell *shell);
-int			process_redirection(t_ast_node *node_cpy, t_shell *shell);
 int			handle_node_command(t_ast_node *node_cpy, t_shell *shell,
 				int *is_pipe);
 int			execute_command(t_ast_node **node, t_shell *shell, int is_pipe);
@@ -68,33 +61,28 @@ int			cleanup_and_wait(pid_t pid, t_shell *shell, int fd_in,
 				int pipe_read_end);
 char		*find_command_in_path(const char *command, t_env *env);
 t_ast_node	*find_execution_node(t_ast_node *cmd, int *is_pipe);
-t_ast_node	*find_output_redirection(t_ast_node *cmd_node);
 t_command	generate_full_command(t_ast_node *node);
 void		setup_child_io(int fd_in, int is_pipe,
 				int pipe_fds[2], t_ast_node *node);
 pid_t		create_child_process(void);
 int			create_pipe(int pipe_fd[2]);
+int			dup_cloexec(int fd);
 char		*resolve_command_path(t_command command, t_shell *shell);
 int			handle_pipe_node(t_ast_node *node, t_shell *shell);
 int			process_pipe_right(t_ast_node *right_node, int left_fd,
 				t_shell *shell, int is_pipe);
-t_ast_node	*process_right_redir_input(t_ast_node *current, t_shell *shell,
-				int *last_input_fd);
-int			process_right_redirection_output(t_ast_node *right_node,
-				int cmd_fd, int is_pipe);
 int			process_pipe_right_redirection(t_ast_node *right_node,
 				int left_fd, t_shell *shell, int is_pipe);
-t_ast_node	*find_cmd_node(t_ast_node *current);
-int			handle_input_redirection(t_ast_node *current, t_shell *shell,
-				int *last_input_fd);
 void		preserve_command_exit_status(t_shell *shell, int status);
-int			handle_output_redirection(t_ast_node *current,
-				t_ast_node **last_output);
-int			execute_cmd_with_redirections(t_ast_node *cmd_node,
-				t_ast_node *last_output, int last_input_fd, t_shell *shell);
 int			handle_command_node(t_ast_node *node, t_shell *shell, int is_pipe);
-int			handle_redirection_node(t_ast_node *node, t_shell *shell);
+int			handle_redirection_node(t_ast_node *node, t_shell *shell,
+				int is_pipe);
 bool		more_execution(int fd, char *buffer, size_t buffer_size);
+void		flush_output_fd(int fd, bool is_more);
 bool		is_more_last_command(t_ast_node *node);
+char		**assign_take_prefix(t_ast_node *node);
+int			assign_statement(char **words, t_shell *shell, int is_pipe);
+bool		assign_apply(char **words, t_shell *shell, t_env **saved);
+void		assign_restore(char **words, t_shell *shell, t_env *saved);
 
 #endif
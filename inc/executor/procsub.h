@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:37 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:20:37 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file procsub.h
+ * @brief Process substitution: `<(list)` and `>(list)`.
+ * 
+ * Right before a command is launched, every process substitution among its
+ * arguments and redirection targets is parsed into a subshell node and run
+ * in a child connected to the shell by a pipe. The word is replaced by the
+ * `/dev/fd/N` path of the shell's end of the pipe, which the command
+ * inherits. The shell closes its ends once the command has been launched
+ * and reaps the children when the command line is over. Command
+ * substitutions run their list with the same subshell helpers.
+ */
+
+#ifndef PROCSUB_H
+# define PROCSUB_H
+
+# include "types.h"
+# include <sys/types.h>
+
+/* Process substitutions a single command line can run */
+# define PROCSUB_MAX	32
+
+/**
+ * @brief Process substitutions started by the running command line.
+ * 
+ * pids and fds hold the child and the shell's end of the pipe of each
+ * substitution, count how many were started and closed how many of the
+ * ends the shell already closed. A pid is set to 0 once reaped.
+ */
+typedef struct s_procsub
+{
+	pid_t	pids[PROCSUB_MAX];
+	int		fds[PROCSUB_MAX];
+	size_t	count;
+	size_t	closed;
+}				t_procsub;
+
+t_ast_node	*parse_subshell(const char *list, size_t len, t_shell *shell);
+void		run_subshell(t_ast_node *subshell, int fds[2], int target,
+				t_shell *shell);
+bool		procsub_expand(char **words, t_shell *shell);
+bool		procsub_expand_plan(t_redir_plan *plan, t_shell *shell);
+char		*procsub_path(int fd);
+void		procsub_close(t_shell *shell);
+void		procsub_reap(t_shell *shell);
+bool		procsub_reaped(t_shell *shell, pid_t pid);
+
+#endif
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan.h
+ * @brief Declarations of the compiled redirection plans.
+ * 
+ * The redirection chain of a command is compiled once into an ordered list
+ * of open/dup/close operations stored on the command node. The bodies of
+ * all the heredocs of a command line are collected before it runs; at
+ * launch the shell opens the target files and writes each body into a pipe
+ * or a memory file, the forked child applies the plan just before execve,
+ * and builtins get it applied to the shell and undone.
+ */
+
+#ifndef REDIR_PLAN_H
+# define REDIR_PLAN_H
+
+# include "types.h"
+# include <fcntl.h>
+# include <limits.h>
+# ifdef __linux__
+#  include <sys/mman.h>
+# endif
+
+/* Lowest descriptor used to save shell fds while a builtin is redirected */
+# define REDIR_SAVE_FD_MIN	10
+
+/* Largest known body written to a pipe; larger ones go to a memory file */
+# define HEREDOC_PIPE_MAX		PIPE_BUF
+# define HEREDOC_TMP_TEMPLATE	"/tmp/minishell-heredoc-XXXXXX"
+
+/* Suffix of the temporary file an atomic output (>^) is written to */
+# define ATOMIC_TMP_SUFFIX		".minishell-XXXXXX"
+
+t_redir_plan	*compile_redir_plan(t_ast_node *node);
+void			free_redir_plan(t_redir_plan **plan);
+bool			redir_plan_open(t_redir_plan *plan, t_shell *shell);
+bool			redir_plan_open_heredocs(t_redir_plan *plan);
+void			redir_plan_close(t_redir_plan *plan);
+bool			pipeline_redir_failed(t_ast_node *node);
+void			redir_op_error(t_redir_op *op);
+int				open_noclobber(const char *path, int flags);
+int				open_atomic(t_redir_op *op, bool noclobber);
+void			redir_plan_finish(t_redir_plan *plan, bool keep);
+void			redir_plan_commit(t_ast_node *node, int status);
+int				redir_plan_apply(t_redir_plan *plan);
+int				redir_plan_apply_saved(t_redir_plan *plan);
+void			redir_plan_restore(t_redir_plan *plan, int applied);
+bool			redir_plan_targets(t_redir_plan *plan, int fd);
+int				open_buffered_input(const char *data, size_t len);
+bool			write_all(int fd, const char *data, size_t len);
+void			heredoc_eof_warning(const char *delimiter);
+bool			collect_heredocs(t_ast_node *root, t_shell *shell);
+bool			read_heredoc_bodies(t_redir_op **ops, size_t count,
+					t_shell *shell);
+
+#endif
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_cmd.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:05:42 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:42 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file time_cmd.h
+ * @brief Declarations for the `time` keyword.
+ * 
+ * A command line prefixed with `time` reports wall clock, user and system
+ * time and the peak resident set size of the whole pipeline once it has
+ * finished. Every forked stage is registered in a t_time_ctx and its
+ * resource usage is collected through wait4(), so `time -v` can also print
+ * a per-stage breakdown. `time -p` uses the POSIX output format.
+ */
+
+#ifndef TIME_CMD_H
+# define TIME_CMD_H
+
+# include "types.h"
+# include <stdint.h>
+# include <sys/types.h>
+# include <sys/time.h>
+# include <sys/resource.h>
+# include <time.h>
+
+# define TIME_MAX_STAGES	64
+# define TIME_NAME_LEN		32
+
+/* ru_maxrss is reported in bytes on macOS and in kilobytes on Linux */
+# ifdef __APPLE__
+#  define TIME_RSS_DIVISOR	1024
+# else
+#  define TIME_RSS_DIVISOR	1
+# endif
+
+/**
+ * @brief Accounting data of a single forked pipeline stage.
+ */
+typedef struct s_time_stage
+{
+	pid_t			pid;
+	char			name[TIME_NAME_LEN];
+	struct timespec	start;
+	struct timespec	end;
+	struct rusage	usage;
+	int				status;
+	bool			reaped;
+}	t_time_stage;
+
+/**
+ * @brief State of a command line run under the `time` keyword.
+ */
+typedef struct s_time_ctx
+{
+	bool			verbose;
+	bool			posix;
+	struct timespec	start;
+	struct rusage	self_start;
+	struct rusage	children_start;
+	t_time_stage	stages[TIME_MAX_STAGES];
+	size_t			count;
+}	t_time_ctx;
+
+size_t		parse_time_flags(char **tokens, t_time_ctx *ctx);
+size_t		time_begin(char **tokens, t_time_ctx *ctx, t_shell *shell);
+void		time_end(t_time_ctx *ctx, t_shell *shell);
+void		register_child(t_shell *shell, pid_t pid, const char *name,
+				uint64_t spawn);
+pid_t		shell_wait(t_shell *shell, pid_t pid, int *status, int options);
+long long	elapsed_usec(struct timespec *from, struct timespec *to);
+long long	cpu_usec(struct rusage *end, struct rusage *start, bool user);
+void		time_print_report(t_time_ctx *ctx, struct timespec *now,
+				struct rusage *self, struct rusage *children);
+
+#endif
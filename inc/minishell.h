@@ -18,18 +18,33 @@
 
 // All headers
 # include "ast/ast.h"
+# include "builtins/arith_cmd.h"
 # include "builtins/cd_cmd.h"
 # include "builtins/echo_cmd.h"
 # include "builtins/env_cmd.h"
 # include "builtins/exit_cmd.h"
 # include "builtins/export_cmd.h"
 # include "builtins/pwd_cmd.h"
+# include "builtins/set_cmd.h"
+# include "builtins/shellstats_cmd.h"
 # include "builtins/unset_cmd.h"
+# include "core/arena.h"
+# include "core/build_info.h"
 # include "core/core.h"
 # include "core/dynamic_buffer.h"
+# include "core/fd_audit.h"
+# include "core/profile.h"
 # include "env/env.h"
+# include "env/env_arith.h"
+# include "env/env_param.h"
+# include "env/env_glob.h"
+# include "env/env_brace.h"
 # include "env/env_shlvl.h"
+# include "executor/cmdsub.h"
 # include "executor/executor.h"
+# include "executor/procsub.h"
+# include "executor/redir_plan.h"
+# include "executor/time_cmd.h"
 # include "parser/parser.h"
 # include "parser/parser_errors.h"
 # include "parser/parser_group.h"
@@ -42,6 +57,7 @@
 # include "utils/char_utils.h"
 # include "utils/debug_print_ast.h"
 # include "utils/get_next_line.h"
+# include "utils/glob_match.h"
 # include "utils/mem_utils.h"
 # include "utils/num_utils.h"
 # include "utils/path_search.h"
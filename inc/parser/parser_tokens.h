@@ -21,8 +21,22 @@
 # include "ast/ast.h"
 # include "utils/str_utils.h"
 
-bool	is_pipe_token(const char *token);
-bool	is_redirection_token(const char *token);
-bool	is_operator_token(const char *token);
+bool		is_pipe_token(const char *token);
+bool		is_redirection_token(const char *token);
+bool		is_operator_token(const char *token);
+bool		is_fd_prefix(const char *word, size_t len);
+size_t		redirection_operator_len(const char *s);
+const char	*skip_fd_prefix(const char *token);
+int			get_redirection_fd(const char *token);
+size_t		procsub_len(const char *s);
+bool		is_procsub_word(const char *token);
+size_t		cmdsub_len(const char *s);
+size_t		paren_group_len(const char *s);
+size_t		arith_command_len(const char *s);
+size_t		arith_subst_len(const char *s);
+bool		is_arith_command(const char *token);
+size_t		subst_len(const char *s);
+size_t		param_subst_len(const char *s);
+size_t		dollar_subst_len(const char *s);
 
 #endif
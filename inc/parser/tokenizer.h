@@ -20,8 +20,18 @@
 # define TOKENIZER_H
 
 # include "types.h"
+# include "env/env_glob.h"
 
 char	**tokenize_input(const char *input, t_shell *shell);
-void	expand_tokens(char **tokens, size_t token_count, t_shell *shell);
+void	expand_tokens(char ***tokens, size_t *token_count, t_shell *shell);
+bool	tokenize_batch(char *input, t_batch *batch);
+bool	batch_init(t_batch *batch, char *input);
+bool	batch_push_token(t_batch *batch, char *token);
+bool	batch_end_line(t_batch *batch, char *next);
+bool	lex_cmdsub(t_batch *batch, char *input, size_t *i);
+void	free_batch(t_batch *batch);
+void	expand_batch_line(char **raw, size_t count, t_str_vec *line,
+			t_shell *shell);
+void	release_batch_line(char **raw, size_t count, t_str_vec *line);
 
 #endif
@@ -21,15 +21,9 @@
 # include "types.h"
 # include <stdio.h>
 
-# define BUFFER_CAPACITY 65536
-
 void	free_tokens_array(char **tokens, int count);
 char	*duplicate_input(const char *input);
 void	process_quotes(char **token, char *quote);
 void	finalize_tokens(char **tokens, char *start, int *i);
-void	handle_buffer(char *buffer, size_t *buffer_index, char **tokens,
-			size_t *token_count);
-void	handle_special_characters(const char *input, int *i, t_dynamic_buffer *buffer,
-			t_tokenizer_state *state);
 
 #endif
@@ -26,9 +26,15 @@
 # include <stddef.h>
 # include <stdbool.h>
 # include <stdlib.h>
+# include <sys/types.h>
+
+# define ENV_EXPORTED	1
+# define ENV_READONLY	2
 
 typedef struct s_ast		t_ast;
 typedef struct s_ast_node	t_ast_node;
+typedef struct s_time_ctx	t_time_ctx;
+typedef struct s_procsub	t_procsub;
 
 /**
  * @brief Represents an element in the list of environment variables.
@@ -37,8 +43,16 @@ typedef struct s_ast_node	t_ast_node;
  * It contains a key, a value, and a pointer to the next environment variable.
  * The key is a string that represents the name of the variable.
  * The value is a string that represents the value of the variable.
+ * Both are shared strings (see t_env_str), the key being interned.
+ * flags holds the attributes of the variable: ENV_EXPORTED for those
+ * passed to the commands run (the others are shell variables, set by
+ * `name=value`), ENV_READONLY for those that can no longer be set or
+ * unset.
  * The next pointer points to the next environment variable in the list.
  * The is_freed flag indicates whether the variable has been freed or not.
+ * refs counts the pointers to the node (the head of a list or the next
+ * field of another node): nodes are shared between an environment and its
+ * copy-on-write snapshots.
  */
 typedef struct s_env
 {
@@ -46,6 +60,8 @@ typedef struct s_env
 	char			*value;
 	struct s_env	*next;
 	bool			is_freed;
+	int				refs;
+	int				flags;
 }				t_env;
 
 /**
@@ -57,12 +73,34 @@ typedef struct s_env
  * The ast pointer points to the root of the abstract syntax tree.
  * The exit_status is an integer that keeps the exit status 
  * of the last command.
+ * The timing pointer is set while a command line prefixed with the `time`
+ * keyword runs, so the executor can attribute reaped children to it.
+ * interactive is false when the shell runs a script. heredoc_bodies holds
+ * the heredoc bodies of the running line that were already read from the
+ * script, NULL-terminated, and heredoc_next the next one to use. procsub
+ * points to the process substitutions of the running command line.
+ * expand_error is set when the expansion of a line failed (an invalid
+ * `$((expr))`), so that the line is not run. name, pid and last_bg are
+ * the values of `$0`, `$$` and `$!` (0 until a process substitution has
+ * started, the only processes run in the background). subst_depth counts
+ * the substitution lists being expanded (see parse_subshell).
  */
 typedef struct s_shell
 {
 	t_env		*env;
 	t_ast		*ast;
 	int			exit_status;
+	t_time_ctx	*timing;
+	bool		interactive;
+	char		**heredoc_bodies;
+	size_t		heredoc_next;
+	t_procsub	*procsub;
+	bool		noclobber;
+	bool		expand_error;
+	const char	*name;
+	pid_t		pid;
+	pid_t		last_bg;
+	int			subst_depth;
 }				t_shell;
 
 /**
@@ -93,6 +131,12 @@ typedef enum e_node_type
  * - REDIR_OUTPUT: Represents output redirection.
  * - REDIR_APPEND: Represents append redirection.
  * - REDIR_HEREDOC: Represents here-document redirection.
+ * - REDIR_HERESTRING: Represents here-string redirection (<<<).
+ * - REDIR_DUP_IN: Represents input duplication or close (<&).
+ * - REDIR_DUP_OUT: Represents output duplication or close (>&).
+ * - REDIR_CLOBBER: Represents output redirection ignoring noclobber (>|).
+ * - REDIR_ATOMIC: Represents output written to a temporary file that
+ *   replaces the target once the command succeeded (>^).
  * - REDIR_NONE: Represents no redirection.
  */
 typedef enum e_redir_type
@@ -101,9 +145,68 @@ typedef enum e_redir_type
 	REDIR_OUTPUT,
 	REDIR_APPEND,
 	REDIR_HEREDOC,
+	REDIR_HERESTRING,
+	REDIR_DUP_IN,
+	REDIR_DUP_OUT,
+	REDIR_CLOBBER,
+	REDIR_ATOMIC,
 	REDIR_NONE
 }				t_redir_type;
 
+/**
+ * @brief Redirection plan operation enumeration.
+ * 
+ * - REDIR_OP_OPEN: Opens path with flags and moves it onto fd.
+ * - REDIR_OP_DUP: Duplicates src_fd onto fd.
+ * - REDIR_OP_CLOSE: Closes fd.
+ */
+typedef enum e_redir_op_kind
+{
+	REDIR_OP_OPEN,
+	REDIR_OP_DUP,
+	REDIR_OP_CLOSE
+}			t_redir_op_kind;
+
+/**
+ * @brief One file descriptor operation of a redirection plan.
+ * 
+ * path is the unquoted file name of an open, or the delimiter of a
+ * heredoc. A heredoc is a dup whose src_fd is only known once its body
+ * has been read, right before the command is launched. A here-string is
+ * a heredoc whose body is already known at compile time. type is the
+ * operator the operation comes from, and tmp the temporary file an atomic
+ * output is written to until it is renamed over path.
+ */
+typedef struct s_redir_op
+{
+	t_redir_op_kind	kind;
+	int				fd;
+	int				flags;
+	int				src_fd;
+	char			*path;
+	char			*body;
+	char			*tmp;
+	t_redir_type	type;
+	bool			heredoc;
+}				t_redir_op;
+
+/**
+ * @brief Redirections of a command compiled into fd operations.
+ * 
+ * The operations are kept in source order and applied in that order, so
+ * the last redirection of a descriptor wins. When the plan is applied to
+ * the shell itself (builtins), saved keeps the descriptor each operation
+ * replaced so it can be restored afterwards. failed is set when a target
+ * could not be opened and the command was not launched.
+ */
+typedef struct s_redir_plan
+{
+	t_redir_op	*ops;
+	int			*saved;
+	int			count;
+	bool		failed;
+}				t_redir_plan;
+
 /**
  * @brief Syntax error enumeration.
  * 
@@ -196,33 +299,81 @@ typedef struct s_parser_state
  * This structure represents the context of tokenization.
  * It contains a pointer to the current position in the input string,
  * a pointer to the environment variables, a pointer to the shell,
- * the current variable value, the current variable name,
- * and flags indicating whether inside single or double quotes.
+ * the current variable value and the current variable name. A quoted
+ * part of the token is expanded as a whole by its handler, so the position
+ * is always outside quotes between two steps. mask is set while an
+ * unquoted expansion of a marked word runs (see expand_marked).
  */
 typedef struct s_token_context
 {
-	const char	*ptr;
-	t_env		*env;
-	t_shell		*shell;
-	char		*current_var_value;
-	char		*current_var;
-	bool		in_single_quote;
-	bool		in_double_quote;
+	const char			*ptr;
+	t_env				*env;
+	t_shell				*shell;
+	char				*current_var_value;
+	char				*current_var;
+	t_dynamic_buffer	*mask;
 }				t_token_context;
 
 /**
- * @brief Tokenizer state structure.
+ * @brief Arena block header.
+ * 
+ * The block data follows the header in the same allocation. size is the
+ * capacity of the data area and used the number of bytes handed out.
+ */
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;
+	size_t					size;
+	size_t					used;
+}				t_arena_block;
+
+/**
+ * @brief Bump allocator.
+ * 
+ * Allocations are carved out of the head block and are only released all
+ * together by arena_free. When the head block is full, a new block of at
+ * least block_size bytes is pushed in front of it.
+ */
+typedef struct s_arena
+{
+	t_arena_block	*head;
+	size_t			block_size;
+}				t_arena;
+
+/**
+ * @brief One command line of a batch.
+ * 
+ * source is the NUL-terminated text of the line inside the input, first
+ * the index of its first token in the batch token array and count the
+ * number of tokens. The token after the last one is NULL.
+ */
+typedef struct s_batch_line
+{
+	char	*source;
+	size_t	first;
+	size_t	count;
+}				t_batch_line;
+
+/**
+ * @brief Multi-line input lexed in a single pass.
  * 
- * This structure represents the state of the tokenizer during tokenization.
- * It contains an array of tokens, the number of tokens, the current index
- * in the buffer, and the current quote character.
+ * The token strings live in the arena. tokens holds the tokens of every
+ * line, each line followed by a NULL so that tokens + line.first is a
+ * NULL-terminated array. max_count is the token count of the longest line.
+ * word (start of the word being lexed) and quote are the lexer state.
  */
-typedef struct s_tokenizer_state
+typedef struct s_batch
 {
-	char	**tokens;
-	size_t	token_count;
-	size_t	buffer_index;
-	char	quote;
-}				t_tokenizer_state;
+	t_arena			arena;
+	char			**tokens;
+	size_t			token_count;
+	size_t			token_capacity;
+	t_batch_line	*lines;
+	size_t			line_count;
+	size_t			line_capacity;
+	size_t			max_count;
+	char			*word;
+	char			quote;
+}				t_batch;
 
 #endif
@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file glob_match.h
+ * @brief Shell pattern matching (`*`, `?`, `[...]`).
+ */
+
+#ifndef GLOB_MATCH_H
+# define GLOB_MATCH_H
+
+# include <stdbool.h>
+# include <stddef.h>
+
+bool	glob_match(const char *pattern, const char *str, size_t len);
+char	*pattern_from_word(const char *word);
+
+#endif
@@ -40,7 +40,11 @@
 # define MALLOC_ERR		"Memory allocation error"
 # define SYNTAX_ERR		"Syntax error"
 
+# define NUM_PRINT_MAX	24
+
 void	ft_putstr_fd(const char *s, int fd);
 void	ft_error_msg(const char *prefix, const char *msg);
+void	ft_putnbr_fd(long long n, int fd);
+void	ft_putnbr_pad_fd(long long n, int width, int fd);
 
 #endif
@@ -21,6 +21,7 @@
 
 void	safe_free(void **ptr);
 void	ft_memset(void *ptr, int value, size_t num);
+void	free_redir_plan(t_redir_plan **plan);
 
 /**
  * @brief Frees an AST node.
@@ -31,8 +32,8 @@ void	ft_memset(void *ptr, int value, size_t num);
  * @param node Pointer to the AST node to free.
  * 
  * @note The function frees the memory allocated for the node and its
- * associated data, including the command name, arguments, file name,
- * and child nodes.
+ * associated data, including the command name, arguments, redirection
+ * plan, file name, and child nodes.
  */
 void	free_ast_node(t_ast_node **node)
 {
@@ -45,6 +46,7 @@ void	free_ast_node(t_ast_node **node)
 	if ((*node)->type == NODE_COMMAND)
 	{
 		free_command_node(*node);
+		free_redir_plan(&(*node)->redir_plan);
 	}
 	else if ((*node)->type == NODE_PIPE)
 		free_pipe_node(*node);
@@ -55,6 +55,8 @@ t_ast_node	*allocate_node(t_node_type type)
 	node->fd_in = STDIN_FILENO;
 	node->fd_out = STDOUT_FILENO;
 	node->is_pipe = false;
+	node->redir_plan = NULL;
+	node->write_error = false;
 	ft_memset(&node->data, 0, sizeof(t_node_data));
 	if (type == NODE_COMMAND)
 	{
@@ -72,9 +72,7 @@ t_ast_node	*create_redir_node(t_redir_type redirection, char *file,
 {
 	t_ast_node	*node;
 
-	if (!file || (redirection != REDIR_OUTPUT && redirection
-			!= REDIR_INPUT && redirection != REDIR_APPEND && redirection
-			!= REDIR_HEREDOC))
+	if (!file || redirection >= REDIR_NONE)
 	{
 		safe_free((void **)&file);
 		return (NULL);
@@ -88,6 +86,7 @@ t_ast_node	*create_redir_node(t_redir_type redirection, char *file,
 	node->data.redirection.type = redirection;
 	node->data.redirection.file = file;
 	node->data.redirection.child = childCmd;
+	node->data.redirection.fd = -1;
 	node->next = NULL;
 	node->env = NULL;
 	return (node);
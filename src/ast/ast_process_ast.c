@@ -18,6 +18,7 @@
  */
 
 #include "minishell.h"
+#include "core/profile.h"
 
 void	build_ast(char **tokens, t_ast *ast, t_env *env);
 void	execute_ast(t_ast *ast, t_shell *shell);
@@ -31,15 +32,34 @@ void	print_ast_node(t_ast_node *node, int depth);
  * @param ast The AST to process
  * @param shell The shell containing environment variables
  * 
- * @note This function will build the AST, execute it and free it
+ * @note This function will build the AST, execute it and free it. The
+ * bodies of all its heredocs are read before anything is executed. Debug
+ * builds report the descriptors the line left open. The process
+ * substitutions of the line are reaped once it is over.
  * 
  */
 void	process_ast(char **tokens, t_ast *ast, t_shell *shell)
 {
+	uint64_t	start;
+	t_fd_audit	audit;
+	t_procsub	procsub;
+	t_procsub	*outer;
+
+	fd_audit_snapshot(&audit);
+	procsub.count = 0;
+	procsub.closed = 0;
+	outer = shell->procsub;
+	shell->procsub = &procsub;
+	start = prof_start();
 	build_ast(tokens, ast, shell->env);
-	if (ast->root)
-	{
+	prof_stop(PROF_BUILD_AST, start);
+	if (ast->syntax_error != SYNTAX_OK)
+		shell->exit_status = 2;
+	else if (ast->root && collect_heredocs(ast->root, shell))
 		execute_ast(ast, shell);
+	if (ast->root)
 		free_ast(ast);
-	}
+	procsub_reap(shell);
+	shell->procsub = outer;
+	fd_audit_report(&audit, tokens);
 }
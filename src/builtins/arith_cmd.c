@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_cmd.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:07 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:41:07 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file arith_cmd.c
+ * @brief Implementation of the `((expr))` command.
+ * 
+ * The expression is evaluated in the shell, so its assignments stay set.
+ * The status is 0 when its value is not zero, 1 when it is zero or when
+ * the expression is invalid, which makes `((i < 10))` usable as a test.
+ */
+
+#include "minishell.h"
+#include "builtins/arith_cmd.h"
+#include "env/env_arith.h"
+
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Runs a `((expr))` command.
+ * 
+ * @param node The command node; its name is the whole `((expr))` word.
+ * @param shell The shell.
+ */
+void	handle_arith_command(t_ast_node *node, t_shell *shell)
+{
+	char	*name;
+	char	*expr;
+	int64_t	value;
+
+	name = node->data.command.name;
+	shell->exit_status = 1;
+	expr = ft_strndup(name + 2, ft_strlen(name) - 4);
+	if (!expr)
+		return ;
+	if (arith_eval(expr, shell, &value) && value != 0)
+		shell->exit_status = 0;
+	free(expr);
+}
@@ -27,7 +27,7 @@ char	*ft_strjoin(const char *s1, const char *s2);
  * @brief Update the environment variables for PWD and OLDPWD.
  * 
  * This function updates the OLDPWD and PWD environment variables
- * with the current working directory.
+ * with the current working directory. OLDPWD shares the string of PWD.
  * 
  * @param env A pointer to the environment structure.
  */
@@ -35,7 +35,7 @@ static void	update_env_vars(t_env *env)
 {
 	char	*cwd;
 
-	env_set_value(env, "OLDPWD", get_env_value("PWD", env));
+	env_set_shared(env, "OLDPWD", get_env_value("PWD", env));
 	cwd = get_current_directory();
 	if (cwd)
 	{
@@ -83,7 +83,7 @@ char	*handle_oldpwd(t_env *env)
 		return (NULL);
 	}
 	printf("%s\n", path);
-	env_set_value(env, "OLDPWD", get_env_value("PWD", env));
+	env_set_shared(env, "OLDPWD", get_env_value("PWD", env));
 	return (path);
 }
 
@@ -104,7 +104,7 @@ char	*get_cd_path(char **args, t_env *env, bool *free_dir)
 
 	if (!args[1])
 	{
-		path = getenv("HOME");
+		path = get_env_value("HOME", env);
 		if (!path)
 		{
 			ft_putstr_fd("minishell: cd: HOME not set\n", STDERR_FILENO);
@@ -11,6 +11,7 @@
 /* ************************************************************************** */
 
 #include "builtins/echo_cmd.h"
+#include "core/dynamic_buffer.h"
 
 char	*handle_quotes(char *arg);
 char	*create_empty_echo(void);
@@ -18,8 +19,6 @@ void	handle_echo_output(t_ast_node *node, char *str);
 char	*prepare_echo_string(char *processed, int new_line);
 void	write_echo_output(int fd, char *str);
 void	*safe_malloc(size_t size);
-char	*ft_strcat(char *dest, const char *src);
-char	*expand_home(char *arg, t_env *env);
 
 /** 
  * @brief Handles the echo command flags.
@@ -55,86 +54,52 @@ void	handle_echo_flags(char **args, int *arg_num, int *new_line)
 	}
 }
 
-/**
- * @brief Concatenates a single argument with the current result
- * 
- * @param result Current concatenated string
- * @param arg Argument to concatenate
- * @param add_space Whether to add a space after the argument
- * @param env Environment variables for tilde expansion
- * @return Updated concatenated string or NULL on error
- */
-static char	*concat_single_arg(char *result, char *arg, int add_space,
-	t_env *env)
-{
-	char	*temp;
-	char	*expanded;
-	char	*new_result;
-
-	expanded = expand_home(arg, env);
-	if (!expanded)
-		return (NULL);
-	temp = result;
-	new_result = safe_malloc(ft_strlen(temp) + ft_strlen(expanded) + 1
-			+ add_space);
-	if (!new_result)
-		return (NULL);
-	ft_strcpy(new_result, temp);
-	ft_strcat(new_result, expanded);
-	if (add_space)
-		ft_strcat(new_result, " ");
-	safe_free((void **)&temp);
-	safe_free((void **)&expanded);
-	return (new_result);
-}
-
 /** 
  * @brief Concatenates the arguments passed to the echo command.
  * 
- * This function concatenates the arguments passed to the echo command.
+ * This function concatenates the arguments passed to the echo command
+ * into a growing buffer, so that a long list of arguments is copied once.
+ * 
+ * The arguments were already expanded, a leading tilde included, with
+ * the rest of the command line.
  * 
  * @param args An array of strings representing the arguments passed
  * to the echo command.
- * @param env The environment variables list.
  * @return A pointer to the concatenated string.
  */
-static char	*concat_args(char **args, int start_index, t_env *env)
+static char	*concat_args(char **args, int start_index)
 {
-	char	*result;
-	int		i;
-	int		add_space;
+	t_dynamic_buffer	buf;
+	int					i;
 
-	result = ft_strdup("");
-	if (!result)
+	if (!init_buffer(&buf, MIN_BUFFER_SIZE))
 		return (NULL);
 	i = start_index;
 	while (args[i])
 	{
-		add_space = (args[i + 1] != NULL);
-		result = concat_single_arg(result, args[i], add_space, env);
-		if (!result)
-			return (NULL);
+		if (!append_to_buffer(&buf, args[i], ft_strlen(args[i]))
+			|| (args[i + 1] && !append_to_buffer(&buf, " ", 1)))
+			return (free_buffer(&buf), NULL);
 		i++;
 	}
-	return (result);
+	return (buf.data);
 }
 
 /**
  * @brief Process echo command arguments
  * 
  * @param args Command arguments
- * @param env Environment variables
+ * @param arg_num Index of the first argument to print
  * @param new_line Newline flag
  * @return Processed string ready for output
  */
-static char	*process_echo_args(char **args, t_env *env,
-					int arg_num, int new_line)
+static char	*process_echo_args(char **args, int arg_num, int new_line)
 {
 	char	*concatenated;
 	char	*processed;
 	char	*str;
 
-	concatenated = concat_args(args, arg_num, env);
+	concatenated = concat_args(args, arg_num);
 	if (!concatenated)
 		return (NULL);
 	processed = handle_quotes(concatenated);
@@ -151,9 +116,8 @@ static char	*process_echo_args(char **args, t_env *env,
  * prints the arguments passed to it.
  * 
  * @param node A pointer to the AST node representing the echo command.
- * @param shell A pointer to the shell structure.
  */
-void	handle_echo(t_ast_node *node, t_shell *shell)
+void	handle_echo(t_ast_node *node)
 {
 	int		arg_num;
 	int		new_line;
@@ -170,7 +134,7 @@ void	handle_echo(t_ast_node *node, t_shell *shell)
 		return ;
 	}
 	handle_echo_flags(args, &arg_num, &new_line);
-	str = process_echo_args(args, shell->env, arg_num, new_line);
+	str = process_echo_args(args, arg_num, new_line);
 	if (str)
 		handle_echo_output(node, str);
 }
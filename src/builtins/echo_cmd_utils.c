@@ -14,36 +14,9 @@
 
 void	*safe_malloc(size_t size);
 char	*ft_strcat(char *dest, const char *src);
-int		get_fd_from_str(void *str);
+void	builtin_output(t_ast_node *node, const char *str);
 char	*ft_strcat(char *dest, const char *src);
 
-/**
- * @brief Expands tildes to the home directory using the t_env list.
- * 
- * @param arg The argument to process.
- * @param env The linked list of environment variables.
- * @return A pointer to the string with the expanded tilde.
- */
-char	*expand_home(char *arg, t_env *env)
-{
-	char	*home;
-	char	*expanded;
-
-	if (arg[0] == '~' && (arg[1] == '\0' || arg[1] == '/'))
-	{
-		home = get_env_value("HOME", env);
-		if (!home)
-			return (ft_strdup(arg));
-		expanded = safe_malloc(ft_strlen(home) + ft_strlen(arg));
-		if (!expanded)
-			return (NULL);
-		ft_strcpy(expanded, home);
-		ft_strcat(expanded, arg + 1);
-		return (expanded);
-	}
-	return (ft_strdup(arg));
-}
-
 /**
  * @brief Writes echo output to file descriptor
  * 
@@ -106,6 +79,6 @@ void	handle_echo_output(t_ast_node *node, char *str)
 		safe_free((void **)&str);
 		return ;
 	}
-	node->fd_in = get_fd_from_str(str);
+	builtin_output(node, str);
 	safe_free((void **)&str);
 }
@@ -20,9 +20,10 @@
  */
 
 #include "builtins/env_cmd.h"
+#include "core/dynamic_buffer.h"
 
 void	*safe_malloc(size_t size);
-int		get_fd_from_str(void *str);
+void	builtin_output(t_ast_node *node, const char *str);
 
 /** 
  * @brief Calculate the total length needed for the environment string
@@ -39,7 +40,7 @@ static size_t	calculate_env_length(t_env *env)
 	total_len = 0;
 	while (current)
 	{
-		if (current->value)
+		if (current->value && (current->flags & ENV_EXPORTED))
 			total_len += ft_strlen(current->key)
 				+ ft_strlen(current->value) + 2;
 		current = current->next;
@@ -48,7 +49,7 @@ static size_t	calculate_env_length(t_env *env)
 }
 
 /** 
- * @brief Build the environment string with all env variables
+ * @brief Build the environment string with the exported variables
  * 
  * @param env A pointer to the environment structure
  * @return char* The built environment string or NULL on failure
@@ -67,7 +68,7 @@ static char	*build_env_string(t_env *env)
 	current = env;
 	while (current)
 	{
-		if (current->value)
+		if (current->value && (current->flags & ENV_EXPORTED))
 		{
 			ft_strcat(str, current->key);
 			ft_strcat(str, "=");
@@ -79,10 +80,38 @@ static char	*build_env_string(t_env *env)
 	return (str);
 }
 
+/**
+ * @brief Lists the variables that have a value, exported or not, as
+ * `name='value'`: the output of set without argument.
+ * 
+ * @param node The command node, for the output.
+ * @param env The environment list.
+ */
+void	list_shell_variables(t_ast_node *node, t_env *env)
+{
+	t_dynamic_buffer	buf;
+
+	if (!init_buffer(&buf, MIN_BUFFER_SIZE))
+		return ;
+	while (env)
+	{
+		if (env->value)
+		{
+			append_to_buffer(&buf, env->key, ft_strlen(env->key));
+			append_to_buffer(&buf, "='", 2);
+			append_to_buffer(&buf, env->value, ft_strlen(env->value));
+			append_to_buffer(&buf, "'\n", 2);
+		}
+		env = env->next;
+	}
+	builtin_output(node, buf.data);
+	free_buffer(&buf);
+}
+
 /** 
  * @brief Handle the env command
  * 
- * This function processes the env command, which lists all environment variables
+ * This function processes the env command, which lists the exported variables
  * in the shell's environment.
  * 
  * @param node A pointer to the AST node representing the env command
@@ -101,7 +130,7 @@ void	handle_env(t_ast_node *node, t_env *env)
 		safe_free((void **)&str);
 		return ;
 	}
-	node->fd_in = get_fd_from_str(str);
+	builtin_output(node, str);
 	safe_free((void **)&str);
 	while (node->next && node->next->type == NODE_COMMAND
 		&& ft_strcmp(node->next->data.command.name, "env") == 0)
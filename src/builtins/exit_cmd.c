@@ -39,6 +39,7 @@ int		ft_atoi(const char *str);
 void	*safe_malloc(size_t size);
 size_t	ft_strlen(const char *s);
 void	safe_free(void *ptr);
+void	prof_dump_at_exit(void);
 
 /**
  * @brief Frees the environment list and exits the shell.
@@ -67,6 +68,7 @@ void	quit_shell(t_shell *shell)
 	}
 	if (isatty(STDIN_FILENO))
 		ft_putstr_fd("exit\n", STDOUT_FILENO);
+	prof_dump_at_exit();
 	rl_clear_history();
 	exit(last_status);
 }
@@ -19,13 +19,21 @@ int		get_fd_from_str(void *str);
  * @brief Helper function to append the formatted environment variable to 
  * the result
  * 
+ * The attributes of the variable follow `declare -`: r for readonly, x
+ * for exported.
+ * 
  * @param res The string to append to
  * @param cur The current environment variable
  * @param len The maximum length of the string
  */
 static void	append_env_var_to_result(char *res, t_env *cur, size_t len)
 {
-	ft_strlcat(res, "declare -x ", len);
+	ft_strlcat(res, "declare -", len);
+	if (cur->flags & ENV_READONLY)
+		ft_strlcat(res, "r", len);
+	if (cur->flags & ENV_EXPORTED)
+		ft_strlcat(res, "x", len);
+	ft_strlcat(res, " ", len);
 	ft_strlcat(res, cur->key, len);
 	if (cur->value)
 	{
@@ -39,14 +47,16 @@ static void	append_env_var_to_result(char *res, t_env *cur, size_t len)
 /**
  * @brief Get export response
  * 
- * This function prints the export command, which lists all environment variables
- * in the shell's environment.
+ * This function prints the export command, which lists the variables
+ * of the shell's environment that have an attribute: the exported ones
+ * for export, the readonly ones for readonly.
  *
  * @param env A pointer to the environment structure containing
  * environment variables.
- * @return A string containing all environment variables.
+ * @param flag The attribute of the variables to list.
+ * @return A string containing the variables.
  */
-char	*get_export_res(t_env *env)
+char	*get_export_res(t_env *env, int flag)
 {
 	t_env	*cur;
 	size_t	len;
@@ -56,7 +66,7 @@ char	*get_export_res(t_env *env)
 	len = 1;
 	while (cur)
 	{
-		len += ft_strlen("declare -x ") + ft_strlen(cur->key) + 2;
+		len += ft_strlen("declare -rx ") + ft_strlen(cur->key) + 2;
 		if (cur->value)
 			len += ft_strlen(cur->value) + 3;
 		cur = cur->next;
@@ -68,7 +78,8 @@ char	*get_export_res(t_env *env)
 	cur = env;
 	while (cur)
 	{
-		append_env_var_to_result(res, cur, len);
+		if (cur->flags & flag)
+			append_env_var_to_result(res, cur, len);
 		cur = cur->next;
 	}
 	return (res);
@@ -112,38 +123,58 @@ char	*extract_var_name(const char *str, char **value)
 	return (var_name);
 }
 
+/**
+ * @brief Handles one `name[=value]` argument of export or readonly.
+ *
+ * The variable gets the value, if there is one, and the attribute of the
+ * command. A shell variable that gets exported keeps its value.
+ *
+ * @param arg The argument.
+ * @param shell A pointer to the shell structure.
+ * @param flag ENV_EXPORTED for export, ENV_READONLY for readonly.
+ */
+void	declare_arg(char *arg, t_shell *shell, int flag)
+{
+	char	*var_name;
+	char	*value;
+
+	if (!is_valid_export_arg(arg))
+	{
+		print_export_error(arg, shell, flag);
+		return ;
+	}
+	value = NULL;
+	var_name = extract_var_name(arg, &value);
+	if (!var_name && !ft_strchr(arg, '='))
+		var_name = ft_strdup(arg);
+	value = process_export_value(value);
+	if (var_name)
+		update_environment(shell, var_name, value, flag);
+	safe_free((void **)&var_name);
+	safe_free((void **)&value);
+}
+
 /** 
  * @brief Handles the export command for the minishell.
  * 
- * This function processes the export command, setting or
- * updating the value of an environment variable in the
- * shell's environment.
+ * This function processes the export command, exporting each of its
+ * arguments, with the value it sets if any, to the commands run.
  * 
  * @param node A pointer to the AST node representing the export command.
  * @param shell A pointer to the environment structure.
  */
 void	handle_export(t_ast_node *node, t_shell *shell)
 {
-	char	*var_name;
-	char	*value;
 	char	**args;
+	int		i;
 
-	var_name = NULL;
-	value = NULL;
 	args = node->data.command.args;
 	if (!args[1])
 	{
-		handle_export_output(node, get_export_res(shell->env));
-		return ;
-	}
-	if (!is_valid_export_arg(args[1]))
-	{
-		print_export_error(args[1], shell);
+		handle_export_output(node, get_export_res(shell->env, ENV_EXPORTED));
 		return ;
 	}
-	var_name = extract_var_name(args[1], &value);
-	value = process_export_value(value);
-	update_environment(node, shell, var_name, value);
-	safe_free((void **)&var_name);
-	safe_free((void **)&value);
+	i = 1;
+	while (args[i])
+		declare_arg(args[i++], shell, ENV_EXPORTED);
 }
@@ -14,7 +14,7 @@
 #include "minishell.h"
 
 void	*safe_malloc(size_t size);
-int		get_fd_from_str(void *str);
+void	builtin_output(t_ast_node *node, const char *str);
 
 /**
  * @brief Handles writing export result to file descriptor or creating a 
@@ -33,7 +33,7 @@ void	handle_export_output(t_ast_node *node, char *export_result)
 		safe_free((void **)&export_result);
 		return ;
 	}
-	node->fd_in = get_fd_from_str(export_result);
+	builtin_output(node, export_result);
 	safe_free((void **)&export_result);
 }
 
@@ -42,10 +42,14 @@ void	handle_export_output(t_ast_node *node, char *export_result)
  * 
  * @param arg The invalid argument
  * @param shell The shell context to update exit status
+ * @param flag ENV_READONLY when it comes from readonly
  */
-void	print_export_error(char *arg, t_shell *shell)
+void	print_export_error(char *arg, t_shell *shell, int flag)
 {
-	ft_putstr_fd("export: '", 2);
+	if (flag == ENV_READONLY)
+		ft_putstr_fd("readonly: '", 2);
+	else
+		ft_putstr_fd("export: '", 2);
 	ft_putstr_fd(arg, 2);
 	ft_putstr_fd("': not a valid identifier\n", 2);
 	shell->exit_status = 1;
@@ -71,18 +75,14 @@ char	*process_export_value(char *value)
 /**
  * @brief Updates environment with new variable
  * 
- * @param node The AST node
  * @param shell The shell context
  * @param var_name The variable name
- * @param value The variable value
+ * @param value The variable value, or NULL to keep the current one
+ * @param flag The attribute to give the variable
  */
-void	update_environment(t_ast_node *node, t_shell *shell,
-						char *var_name, char *value)
+void	update_environment(t_shell *shell, char *var_name, char *value,
+	int flag)
 {
-	if (node->is_pipe)
-		return ;
-	if (var_name && value)
-		env_append_node(&shell->env, var_name, value);
-	else if (var_name)
-		env_create_empty_node(shell->env, var_name);
+	if (!env_assign(&shell->env, var_name, value, flag))
+		shell->exit_status = 1;
 }
@@ -13,7 +13,7 @@
 #include "builtins/pwd_cmd.h"
 
 void	*safe_malloc(size_t size);
-int		get_fd_from_str(void *str);
+void	builtin_output(t_ast_node *node, const char *str);
 
 /**
  * @brief Gets the current working directory.
@@ -75,7 +75,7 @@ void	handle_pwd(t_ast_node *node)
 		safe_free((void **)&cwd);
 		return ;
 	}
-	node->fd_in = get_fd_from_str(str);
+	builtin_output(node, str);
 	safe_free((void **)&str);
 	safe_free((void **)&cwd);
 }
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   readonly_cmd.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:41:05 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:05 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file readonly_cmd.c
+ * @brief Implementation of the readonly built-in command.
+ * 
+ * `readonly name[=value]...` gives the variables the ENV_READONLY flag,
+ * after setting their value if one is given; they can then no longer be
+ * assigned or unset. Without argument, the readonly variables are listed
+ * as `declare -r` commands, as export lists the exported ones.
+ */
+
+#include "builtins/export_cmd.h"
+
+/**
+ * @brief Handles the readonly command.
+ * 
+ * @param node A pointer to the AST node representing the command.
+ * @param shell A pointer to the shell structure.
+ */
+void	handle_readonly(t_ast_node *node, t_shell *shell)
+{
+	char	**args;
+	int		i;
+
+	args = node->data.command.args;
+	if (!args[1])
+	{
+		handle_export_output(node, get_export_res(shell->env, ENV_READONLY));
+		return ;
+	}
+	i = 1;
+	while (args[i])
+		declare_arg(args[i++], shell, ENV_READONLY);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set_cmd.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:20:05 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file set_cmd.c
+ * @brief Implementation of the set built-in command.
+ * 
+ * Only the shell options are handled: `set -o name` and `set +o name` turn
+ * an option on and off, `-C` and `+C` are the short form of noclobber, and
+ * `set -o` alone lists the options (`set +o` as the commands that restore
+ * them). Other arguments are ignored. Without argument, set lists the
+ * variables of the shell, exported or not.
+ */
+
+#include "minishell.h"
+#include "builtins/set_cmd.h"
+#include "builtins/env_cmd.h"
+
+void	builtin_output(t_ast_node *node, const char *str);
+
+/**
+ * @brief Returns the flag of the shell behind an option name.
+ * 
+ * @param name The option name.
+ * @param shell The shell.
+ * @return The flag, or NULL for an unknown option.
+ */
+static bool	*find_option(const char *name, t_shell *shell)
+{
+	if (ft_strcmp(name, "noclobber") == 0)
+		return (&shell->noclobber);
+	return (NULL);
+}
+
+/**
+ * @brief Lists the options and their state.
+ * 
+ * @param node The command node, for the output.
+ * @param shell The shell.
+ * @param as_commands Whether to print them as `set` commands.
+ */
+static void	list_options(t_ast_node *node, t_shell *shell, bool as_commands)
+{
+	if (as_commands && shell->noclobber)
+		builtin_output(node, "set -o noclobber\n");
+	else if (as_commands)
+		builtin_output(node, "set +o noclobber\n");
+	else if (shell->noclobber)
+		builtin_output(node, "noclobber      \ton\n");
+	else
+		builtin_output(node, "noclobber      \toff\n");
+}
+
+/**
+ * @brief Handles `-o name` and `+o name`.
+ * 
+ * @param node The command node.
+ * @param args The arguments, starting at `-o` or `+o`.
+ * @param shell The shell.
+ * @return The number of arguments used after `-o`.
+ */
+static int	set_long_option(t_ast_node *node, char **args, t_shell *shell)
+{
+	bool	*option;
+
+	if (!args[1])
+		return (list_options(node, shell, args[0][0] == '+'), 0);
+	option = find_option(args[1], shell);
+	if (!option)
+	{
+		ft_putstr_fd("minishell: set: ", STDERR_FILENO);
+		ft_putstr_fd(args[1], STDERR_FILENO);
+		ft_putstr_fd(": invalid option name\n", STDERR_FILENO);
+		shell->exit_status = 1;
+		return (1);
+	}
+	*option = (args[0][0] == '-');
+	return (1);
+}
+
+/**
+ * @brief Handles a group of short options such as `-C` or `+C`.
+ * 
+ * @param arg The argument.
+ * @param shell The shell.
+ */
+static void	set_short_options(const char *arg, t_shell *shell)
+{
+	int	i;
+
+	i = 1;
+	while (arg[i])
+	{
+		if (arg[i] != 'C')
+		{
+			ft_putstr_fd("minishell: set: ", STDERR_FILENO);
+			write(STDERR_FILENO, arg, 1);
+			write(STDERR_FILENO, arg + i, 1);
+			ft_putstr_fd(": invalid option\n", STDERR_FILENO);
+			shell->exit_status = 2;
+			return ;
+		}
+		shell->noclobber = (arg[0] == '-');
+		i++;
+	}
+}
+
+/**
+ * @brief Executes the set command.
+ * 
+ * The options are read until the first argument that is not one, or `--`.
+ * 
+ * @param node A pointer to the AST node representing the command.
+ * @param shell A pointer to the shell structure.
+ */
+void	handle_set(t_ast_node *node, t_shell *shell)
+{
+	char	**args;
+	int		i;
+
+	args = node->data.command.args;
+	shell->exit_status = 0;
+	if (!args[1])
+		list_shell_variables(node, shell->env);
+	i = 1;
+	while (args[i] && shell->exit_status == 0
+		&& (args[i][0] == '-' || args[i][0] == '+') && args[i][1])
+	{
+		if (ft_strcmp(args[i], "--") == 0)
+			break ;
+		if (args[i][1] == 'o' && !args[i][2])
+			i += set_long_option(node, args + i, shell);
+		else
+			set_short_options(args[i], shell);
+		i++;
+	}
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shellstats_cmd.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:52:43 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:52:43 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include "builtins/shellstats_cmd.h"
+#include "core/profile.h"
+
+void	builtin_output(t_ast_node *node, const char *str);
+
+/**
+ * @brief Executes the shellstats command.
+ * 
+ * This function prints the per-phase latency histograms of the shell, or
+ * clears them when called with -r. Profiling must have been enabled with
+ * MINISHELL_PROFILE or --profile.
+ * 
+ * @param node A pointer to the AST node representing the command.
+ * @param shell A pointer to the shell structure.
+ */
+void	handle_shellstats(t_ast_node *node, t_shell *shell)
+{
+	t_dynamic_buffer	buffer;
+	char				**args;
+
+	args = node->data.command.args;
+	shell->exit_status = 1;
+	if (!*prof_instance())
+	{
+		ft_putstr_fd("minishell: shellstats: profiling is disabled "
+			"(set " PROF_ENV_VAR "=1)\n", STDERR_FILENO);
+		return ;
+	}
+	shell->exit_status = 0;
+	if (args && args[1] && ft_strcmp(args[1], "-r") == 0)
+		return (prof_reset());
+	if (!init_buffer(&buffer, MIN_BUFFER_SIZE))
+		return ;
+	if (prof_render(&buffer))
+	{
+		if (node->fd_out != STDOUT_FILENO)
+			write(node->fd_out, buffer.data, buffer.size);
+		else
+			builtin_output(node, buffer.data);
+	}
+	free_buffer(&buffer);
+}
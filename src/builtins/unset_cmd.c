@@ -33,6 +33,7 @@
  *
  * @note The function removes the specified environment variable from the
  * environment list. If no variable is specified, the function does nothing.
+ * A readonly variable is kept, and the status set to 1.
  */
 void	handle_unset(char **args, t_shell *shell)
 {
@@ -45,7 +46,15 @@ void	handle_unset(char **args, t_shell *shell)
 	while (args[i])
 	{
 		var_name = ft_strdup(args[i]);
-		shell->env = env_remove_node(shell->env, var_name);
+		if (env_is_readonly(shell->env, var_name))
+		{
+			ft_putstr_fd("minishell: unset: ", STDERR_FILENO);
+			ft_putstr_fd(var_name, STDERR_FILENO);
+			ft_putstr_fd(": cannot unset: readonly variable\n", STDERR_FILENO);
+			shell->exit_status = 1;
+		}
+		else
+			shell->env = env_remove_node(shell->env, var_name);
 		safe_free((void **)&var_name);
 		i++;
 	}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:37 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:37 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file arena.c
+ * @brief Bump allocator for data that is freed all at once.
+ * 
+ * An arena replaces many small malloc/free pairs with a few large blocks:
+ * allocating is a pointer bump and releasing everything is one free per
+ * block.
+ */
+
+#include "minishell.h"
+#include "core/arena.h"
+
+void	*ft_memcpy(void *dst, const void *src, size_t n);
+void	*safe_malloc(size_t size);
+
+/**
+ * @brief Initializes an empty arena.
+ * 
+ * No memory is allocated until the first arena_alloc.
+ * 
+ * @param arena The arena to initialize.
+ * @param block_size The minimum size of each block (ARENA_BLOCK_SIZE if 0).
+ */
+void	arena_init(t_arena *arena, size_t block_size)
+{
+	if (block_size == 0)
+		block_size = ARENA_BLOCK_SIZE;
+	arena->head = NULL;
+	arena->block_size = block_size;
+}
+
+/**
+ * @brief Pushes a new block able to hold at least size bytes.
+ * 
+ * @param arena The arena.
+ * @param size The size of the allocation that did not fit.
+ * @return The new head block, or NULL on allocation failure.
+ */
+static t_arena_block	*arena_grow(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			capacity;
+
+	capacity = arena->block_size;
+	if (capacity < size)
+		capacity = size;
+	block = safe_malloc(sizeof(t_arena_block) + capacity);
+	if (!block)
+		return (NULL);
+	block->next = arena->head;
+	block->size = capacity;
+	block->used = 0;
+	arena->head = block;
+	return (block);
+}
+
+/**
+ * @brief Allocates size bytes aligned to ARENA_ALIGN.
+ * 
+ * @param arena The arena.
+ * @param size The number of bytes.
+ * @return The memory, or NULL on allocation failure.
+ */
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			offset;
+
+	block = arena->head;
+	offset = 0;
+	if (block)
+		offset = (block->used + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (!block || offset + size > block->size)
+	{
+		block = arena_grow(arena, size);
+		if (!block)
+			return (NULL);
+		offset = 0;
+	}
+	block->used = offset + size;
+	return ((char *)(block + 1) + offset);
+}
+
+/**
+ * @brief Copies len bytes of s into the arena as a NUL-terminated string.
+ * 
+ * Strings are not aligned, so consecutive copies are packed together.
+ * 
+ * @param arena The arena.
+ * @param s The string to copy.
+ * @param len The number of bytes to copy.
+ * @return The copy, or NULL on allocation failure.
+ */
+char	*arena_strndup(t_arena *arena, const char *s, size_t len)
+{
+	t_arena_block	*block;
+	char			*copy;
+
+	block = arena->head;
+	if (!block || block->used + len + 1 > block->size)
+	{
+		block = arena_grow(arena, len + 1);
+		if (!block)
+			return (NULL);
+	}
+	copy = (char *)(block + 1) + block->used;
+	block->used += len + 1;
+	ft_memcpy(copy, s, len);
+	copy[len] = '\0';
+	return (copy);
+}
+
+/**
+ * @brief Frees every block of the arena.
+ * 
+ * @param arena The arena, left empty and reusable.
+ */
+void	arena_free(t_arena *arena)
+{
+	t_arena_block	*next;
+
+	while (arena->head)
+	{
+		next = arena->head->next;
+		safe_free((void **)&arena->head);
+		arena->head = next;
+	}
+}
@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   build_info.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:14:02 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:14:02 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file build_info.c
+ * @brief Report of the build profile (`minishell --build-info`).
+ */
+
+#include "minishell.h"
+#include "core/build_info.h"
+
+/**
+ * @brief Prints the build profile, its flags, the compiler and whether
+ * sanitizers and the fd audit are compiled in.
+ * 
+ * @param fd The file descriptor to write to.
+ */
+void	print_build_info(int fd)
+{
+	ft_putstr_fd("profile:    " MS_BUILD_PROFILE "\n", fd);
+	ft_putstr_fd("flags:      " MS_BUILD_FLAGS "\n", fd);
+	ft_putstr_fd("compiler:   " __VERSION__ "\n", fd);
+	if (MS_BUILD_ASAN)
+		ft_putstr_fd("sanitizers: address\n", fd);
+	else
+		ft_putstr_fd("sanitizers: none\n", fd);
+	if (MS_FD_AUDIT)
+		ft_putstr_fd("fd audit:   on\n", fd);
+	else
+		ft_putstr_fd("fd audit:   off\n", fd);
+}
@@ -98,7 +98,8 @@ bool	expand_buffer(t_dynamic_buffer *buffer)
  * 
  * @return true if the data was successfully appended, false otherwise.
  * 
- * @note The buffer must be initialized before calling this function.
+ * @note An uninitialized buffer is initialized first. The capacity is
+ * doubled as many times as needed for the data to fit.
  */
 bool	append_to_buffer(t_dynamic_buffer *buffer, const char *data,
 	size_t data_length)
@@ -108,11 +109,14 @@ bool	append_to_buffer(t_dynamic_buffer *buffer, const char *data,
 
 	if (!buffer || !data)
 		return (false);
-	if (!buffer->data || buffer->capacity == 0)
-		return (!init_buffer(buffer, MIN_BUFFER_SIZE));
-	if (buffer->size + data_length >= buffer->capacity)
+	if ((!buffer->data || buffer->capacity == 0)
+		&& !init_buffer(buffer, MIN_BUFFER_SIZE))
+		return (false);
+	new_capacity = buffer->capacity;
+	while (buffer->size + data_length >= new_capacity)
+		new_capacity *= 2;
+	if (new_capacity != buffer->capacity)
 	{
-		new_capacity = buffer->capacity * 2;
 		new_data = ft_realloc(buffer->data, buffer->size, new_capacity);
 		if (!new_data)
 			return (ft_error_msg("Buffer", "Reallocation failed"), false);
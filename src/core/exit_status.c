@@ -15,7 +15,7 @@
  * * @brief Functions for managing the exit status of the shell.
  * 
  * * This file contains functions to retrieve and set the exit status of the
- * * shell, as well as to expand the "$?" variable in commands. The exit status
+ * * shell, which `$?` expands to (env_special.c). The exit status
  * * is used to indicate the success or failure of command execution. The
  * * functions handle the exit status of child processes and provide a way to
  * * access the exit status from within the shell.
@@ -25,8 +25,6 @@
 #include "types.h"
 #include <sys/wait.h>
 
-char	*ft_itoa(int n);
-
 /**
  * @brief Retrieves the exit status of the shell.
  * 
@@ -77,27 +75,3 @@ void	set_exit_code(t_shell *shell, int status)
 	}
 	shell->exit_status = code;
 }
-
-/**
- * @brief Expands the "$?" variable in a command.
- * 
- * @param shell The shell instance.
- * @return The expanded value of "$?" as a string.
- * 
- * This function expands the "$?" variable in a command. The "$?" variable
- * represents the exit status of the last executed command. The function
- * retrieves the exit status from the shell instance and converts it to a
- * string using ft_itoa. The resulting string is returned to the caller.
- * 
- * @note The caller is responsible for freeing the returned string.
- * 
- */
-char	*expand_dollar_question(t_shell *shell)
-{
-	int		code;
-	char	*expanded;
-
-	code = get_exit_status(shell);
-	expanded = ft_itoa(code);
-	return (expanded);
-}
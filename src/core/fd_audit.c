@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_audit.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:52:31 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:52:31 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file fd_audit.c
+ * @brief Debug audit of the descriptors left open by a command line.
+ * 
+ * A snapshot is a bitmap of the open descriptors, built by probing each
+ * one with fcntl(F_GETFD). It costs FD_AUDIT_MAX system calls, which is
+ * why the audit only exists in debug builds; elsewhere both functions
+ * return at once.
+ */
+
+#include "minishell.h"
+#include "core/fd_audit.h"
+#include <sys/stat.h>
+
+/**
+ * @brief Checks whether a descriptor is open in a snapshot.
+ * 
+ * @param audit The snapshot.
+ * @param fd The descriptor.
+ * @return true if it was open.
+ */
+static bool	is_open(const t_fd_audit *audit, int fd)
+{
+	return ((audit->open[fd / 8] >> (fd % 8)) & 1);
+}
+
+/**
+ * @brief Reports one descriptor left open by a command line.
+ * 
+ * @param fd The descriptor.
+ * @param tokens The tokens of the command line.
+ */
+static void	report_leak(int fd, char **tokens)
+{
+	struct stat	st;
+	const char	*kind;
+
+	kind = "other";
+	if (fstat(fd, &st) == 0 && S_ISFIFO(st.st_mode))
+		kind = "pipe";
+	else if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+		kind = "file";
+	else if (fstat(fd, &st) == 0 && S_ISCHR(st.st_mode))
+		kind = "character device";
+	ft_putstr_fd("minishell: fd audit: fd ", STDERR_FILENO);
+	ft_putnbr_fd(fd, STDERR_FILENO);
+	ft_putstr_fd(" (", STDERR_FILENO);
+	ft_putstr_fd(kind, STDERR_FILENO);
+	ft_putstr_fd(") leaked by `", STDERR_FILENO);
+	while (tokens && *tokens)
+	{
+		ft_putstr_fd(*tokens++, STDERR_FILENO);
+		if (*tokens)
+			ft_putstr_fd(" ", STDERR_FILENO);
+	}
+	ft_putstr_fd("`\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the descriptors open in a snapshot.
+ * 
+ * @param label The name of the snapshot.
+ * @param audit The snapshot.
+ */
+static void	print_open_fds(const char *label, const t_fd_audit *audit)
+{
+	int	fd;
+
+	ft_putstr_fd("minishell: fd audit:   ", STDERR_FILENO);
+	ft_putstr_fd(label, STDERR_FILENO);
+	fd = 0;
+	while (fd < FD_AUDIT_MAX)
+	{
+		if (is_open(audit, fd))
+		{
+			ft_putstr_fd(" ", STDERR_FILENO);
+			ft_putnbr_fd(fd, STDERR_FILENO);
+		}
+		fd++;
+	}
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Records the descriptors currently open in the shell.
+ * 
+ * @param audit The snapshot to fill.
+ */
+void	fd_audit_snapshot(t_fd_audit *audit)
+{
+	int	fd;
+
+	if (!MS_FD_AUDIT)
+		return ;
+	ft_memset(audit->open, 0, sizeof(audit->open));
+	fd = 0;
+	while (fd < FD_AUDIT_MAX)
+	{
+		if (fcntl(fd, F_GETFD) != -1)
+			audit->open[fd / 8] |= (unsigned char)(1 << (fd % 8));
+		fd++;
+	}
+}
+
+/**
+ * @brief Reports the descriptors a command line left open.
+ * 
+ * @param before The snapshot taken before the line ran.
+ * @param tokens The tokens of the command line.
+ */
+void	fd_audit_report(const t_fd_audit *before, char **tokens)
+{
+	t_fd_audit	after;
+	bool		leaked;
+	int			fd;
+
+	if (!MS_FD_AUDIT)
+		return ;
+	fd_audit_snapshot(&after);
+	leaked = false;
+	fd = 0;
+	while (fd < FD_AUDIT_MAX)
+	{
+		if (is_open(&after, fd) && !is_open(before, fd))
+		{
+			report_leak(fd, tokens);
+			leaked = true;
+		}
+		fd++;
+	}
+	if (!leaked)
+		return ;
+	print_open_fds("before:", before);
+	print_open_fds("after: ", &after);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:09:14 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:09:14 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile.c
+ * @brief Activation and probes of the self-profiling mode.
+ * 
+ * Probes are meant to be cheap when profiling is disabled: prof_start()
+ * returns 0 without reading the clock and prof_stop() ignores a 0 start.
+ */
+
+#include "minishell.h"
+#include "core/profile.h"
+#include <sys/mman.h>
+#include <time.h>
+
+/**
+ * @brief Returns the address of the profiling table singleton.
+ * 
+ * @return Address of the table pointer, NULL while profiling is disabled.
+ */
+t_prof_table	**prof_instance(void)
+{
+	static t_prof_table	*table = NULL;
+
+	return (&table);
+}
+
+/**
+ * @brief Reads the monotonic clock.
+ * 
+ * @return The current time in nanoseconds.
+ */
+static uint64_t	prof_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief Enables profiling if requested.
+ * 
+ * The table is allocated in a shared anonymous mapping so that samples
+ * recorded by forked children are visible to the shell.
+ * 
+ * @param force True when the shell was started with --profile.
+ * @param env The environment, checked for MINISHELL_PROFILE.
+ */
+void	prof_init(bool force, t_env *env)
+{
+	char			*value;
+	t_prof_table	*table;
+
+	value = get_env_value(PROF_ENV_VAR, env);
+	if (!force && (!value || !value[0] || ft_strcmp(value, "0") == 0))
+		return ;
+	table = mmap(NULL, sizeof(t_prof_table), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (table == MAP_FAILED)
+	{
+		ft_error_msg(SYS_ERR, "Failed to map the profiling table");
+		return ;
+	}
+	table->owner = getpid();
+	*prof_instance() = table;
+	prof_reset();
+}
+
+/**
+ * @brief Starts measuring a phase.
+ * 
+ * @return The start timestamp, or 0 when profiling is disabled.
+ */
+uint64_t	prof_start(void)
+{
+	if (!*prof_instance())
+		return (0);
+	return (prof_now());
+}
+
+/**
+ * @brief Stops measuring a phase and records its duration.
+ * 
+ * @param phase The measured phase.
+ * @param start The value returned by prof_start().
+ */
+void	prof_stop(t_prof_phase phase, uint64_t start)
+{
+	if (start == 0 || !*prof_instance())
+		return ;
+	prof_record(phase, prof_now() - start);
+}
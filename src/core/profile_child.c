@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile_child.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:30:05 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:30:05 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile_child.c
+ * @brief Tracking of forked children for the PROF_CHILD phase.
+ * 
+ * The fork timestamp of each child is kept until shell_wait() reaps it, so
+ * the full lifetime of the child (as seen from the shell) is recorded.
+ */
+
+#include "minishell.h"
+#include "core/profile.h"
+
+/**
+ * @brief Remembers when a child was forked.
+ * 
+ * @param pid The process id of the child.
+ * @param start The prof_start() timestamp taken before fork().
+ */
+void	prof_child_spawned(pid_t pid, uint64_t start)
+{
+	t_prof_table	*table;
+	size_t			i;
+
+	table = *prof_instance();
+	if (!table || start == 0 || pid <= 0)
+		return ;
+	i = 0;
+	while (i < PROF_MAX_CHILDREN && table->children[i].pid != 0)
+		i++;
+	if (i == PROF_MAX_CHILDREN)
+		return ;
+	table->children[i].pid = pid;
+	table->children[i].start = start;
+}
+
+/**
+ * @brief Records the lifetime of a reaped child.
+ * 
+ * @param pid The process id returned by the wait call.
+ */
+void	prof_child_reaped(pid_t pid)
+{
+	t_prof_table	*table;
+	size_t			i;
+
+	table = *prof_instance();
+	if (!table || pid <= 0)
+		return ;
+	i = 0;
+	while (i < PROF_MAX_CHILDREN)
+	{
+		if (table->children[i].pid == pid)
+		{
+			prof_stop(PROF_CHILD, table->children[i].start);
+			table->children[i].pid = 0;
+			return ;
+		}
+		i++;
+	}
+}
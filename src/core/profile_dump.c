@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile_dump.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:38:56 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:38:56 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile_dump.c
+ * @brief Rendering of the profiling histograms.
+ * 
+ * One line per measured phase with the sample count and the min, p50, p90,
+ * p99, max and mean latencies in nanoseconds. Percentiles are the upper
+ * bound of the histogram bucket they fall in.
+ */
+
+#include "minishell.h"
+#include "core/profile.h"
+
+/**
+ * @brief Appends a right-aligned number column to a buffer.
+ * 
+ * @param buffer The output buffer.
+ * @param value The value to append.
+ * @param width The column width.
+ * @return True on success, false on allocation failure.
+ */
+static bool	append_col(t_dynamic_buffer *buffer, uint64_t value, int width)
+{
+	char	digits[NUM_PRINT_MAX];
+	int		i;
+
+	i = NUM_PRINT_MAX;
+	digits[--i] = '0' + (value % 10);
+	while (value >= 10)
+	{
+		value /= 10;
+		digits[--i] = '0' + (value % 10);
+	}
+	while (NUM_PRINT_MAX - i < width && i > 0)
+		digits[--i] = ' ';
+	return (append_to_buffer(buffer, digits + i, NUM_PRINT_MAX - i));
+}
+
+/**
+ * @brief Finds the value below which a percentage of the samples fall.
+ * 
+ * @param hist The histogram.
+ * @param percent The percentile to compute (0-100).
+ * @return The percentile in nanoseconds, clamped to the recorded maximum.
+ */
+uint64_t	prof_percentile(t_prof_hist *hist, unsigned int percent)
+{
+	uint64_t	wanted;
+	uint64_t	seen;
+	size_t		i;
+
+	if (hist->count == 0)
+		return (0);
+	wanted = (hist->count * percent + 99) / 100;
+	if (wanted == 0)
+		wanted = 1;
+	seen = 0;
+	i = 0;
+	while (i < PROF_BUCKETS)
+	{
+		seen += hist->buckets[i];
+		if (seen >= wanted)
+			break ;
+		i++;
+	}
+	if (i == PROF_BUCKETS || prof_bucket_value(i) > hist->max)
+		return (hist->max);
+	return (prof_bucket_value(i));
+}
+
+/**
+ * @brief Appends the line of one phase to a buffer.
+ * 
+ * @param buffer The output buffer.
+ * @param name The phase name.
+ * @param hist The histogram of the phase.
+ * @return True on success, false on allocation failure.
+ */
+static bool	render_phase(t_dynamic_buffer *buffer, const char *name,
+			t_prof_hist *hist)
+{
+	size_t	len;
+	bool	ok;
+
+	len = ft_strlen(name);
+	ok = append_to_buffer(buffer, name, len);
+	while (ok && len++ < 13)
+		ok = append_char_to_buffer(buffer, ' ');
+	ok = ok && append_col(buffer, hist->count, 9);
+	ok = ok && append_col(buffer, hist->min, 11);
+	ok = ok && append_col(buffer, prof_percentile(hist, 50), 11);
+	ok = ok && append_col(buffer, prof_percentile(hist, 90), 11);
+	ok = ok && append_col(buffer, prof_percentile(hist, 99), 11);
+	ok = ok && append_col(buffer, hist->max, 11);
+	ok = ok && append_col(buffer, hist->sum / hist->count, 11);
+	return (ok && append_char_to_buffer(buffer, '\n'));
+}
+
+/**
+ * @brief Renders every phase that has samples into a buffer.
+ * 
+ * @param buffer An initialized buffer to append to.
+ * @return False if profiling is disabled or on allocation failure.
+ */
+bool	prof_render(t_dynamic_buffer *buffer)
+{
+	static const char	*names[PROF_PHASE_COUNT] = {"validate", "tokenize",
+		"expand", "build_ast", "gen_command", "env_array", "resolve_path",
+		"spawn", "child"};
+	static const char	*header = "phase            count        min"
+		"        p50        p90        p99        max       mean (ns)\n";
+	t_prof_table		*table;
+	size_t				i;
+	bool				ok;
+
+	table = *prof_instance();
+	if (!table)
+		return (false);
+	ok = append_to_buffer(buffer, header, ft_strlen(header));
+	i = 0;
+	while (ok && i < PROF_PHASE_COUNT)
+	{
+		if (table->phases[i].count > 0)
+			ok = render_phase(buffer, names[i], &table->phases[i]);
+		i++;
+	}
+	return (ok);
+}
+
+/**
+ * @brief Prints the histograms on standard error when the shell exits.
+ * 
+ * Only the process that enabled profiling prints, so children that exit
+ * through the shell cleanup paths stay silent.
+ */
+void	prof_dump_at_exit(void)
+{
+	t_prof_table		*table;
+	t_dynamic_buffer	buffer;
+
+	table = *prof_instance();
+	if (!table || table->owner != getpid())
+		return ;
+	if (!init_buffer(&buffer, MIN_BUFFER_SIZE))
+		return ;
+	if (prof_render(&buffer))
+		write(STDERR_FILENO, buffer.data, buffer.size);
+	free_buffer(&buffer);
+}
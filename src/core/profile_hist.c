@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile_hist.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:21:48 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:21:48 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile_hist.c
+ * @brief Log-linear latency histograms used by the profiling mode.
+ * 
+ * Values below 2 * PROF_SUB_COUNT get one bucket each; above that, every
+ * power of two is split in PROF_SUB_COUNT linear sub-buckets, the layout
+ * used by HdrHistogram. Counters are updated with atomic builtins because
+ * the table is shared with the children of the shell.
+ */
+
+#include "minishell.h"
+#include "core/profile.h"
+
+/**
+ * @brief Maps a value to its histogram bucket.
+ * 
+ * @param value The value in nanoseconds.
+ * @return The bucket index, always below PROF_BUCKETS.
+ */
+size_t	prof_bucket_index(uint64_t value)
+{
+	int	msb;
+	int	shift;
+
+	if (value < 2 * PROF_SUB_COUNT)
+		return ((size_t)value);
+	msb = 63 - __builtin_clzll(value);
+	shift = msb - PROF_SUB_BITS;
+	return ((size_t)(shift + 1) * PROF_SUB_COUNT
+		+ (size_t)((value >> shift) - PROF_SUB_COUNT));
+}
+
+/**
+ * @brief Returns the highest value that falls in a bucket.
+ * 
+ * @param index The bucket index.
+ * @return The upper bound of the bucket, in nanoseconds.
+ */
+uint64_t	prof_bucket_value(size_t index)
+{
+	size_t		shift;
+	uint64_t	top;
+
+	if (index < 2 * PROF_SUB_COUNT)
+		return ((uint64_t)index);
+	shift = index / PROF_SUB_COUNT - 1;
+	top = index % PROF_SUB_COUNT + PROF_SUB_COUNT;
+	return (((top + 1) << shift) - 1);
+}
+
+/**
+ * @brief Atomically lowers (or raises) a bound to include a value.
+ * 
+ * @param slot The bound to update.
+ * @param value The new sample.
+ * @param is_max True to keep the maximum, false to keep the minimum.
+ */
+static void	update_bound(uint64_t *slot, uint64_t value, bool is_max)
+{
+	uint64_t	current;
+
+	current = __atomic_load_n(slot, __ATOMIC_RELAXED);
+	while ((is_max && value > current) || (!is_max && value < current))
+	{
+		if (__atomic_compare_exchange_n(slot, &current, value, false,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			break ;
+	}
+}
+
+/**
+ * @brief Records a sample for a phase.
+ * 
+ * @param phase The measured phase.
+ * @param value The duration in nanoseconds.
+ */
+void	prof_record(t_prof_phase phase, uint64_t value)
+{
+	t_prof_table	*table;
+	t_prof_hist		*hist;
+
+	table = *prof_instance();
+	if (!table || phase >= PROF_PHASE_COUNT)
+		return ;
+	hist = &table->phases[phase];
+	__atomic_fetch_add(&hist->count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&hist->sum, value, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&hist->buckets[prof_bucket_index(value)], 1,
+		__ATOMIC_RELAXED);
+	update_bound(&hist->min, value, false);
+	update_bound(&hist->max, value, true);
+}
+
+/**
+ * @brief Clears every histogram and the list of tracked children.
+ */
+void	prof_reset(void)
+{
+	t_prof_table	*table;
+	size_t			i;
+
+	table = *prof_instance();
+	if (!table)
+		return ;
+	i = 0;
+	while (i < PROF_PHASE_COUNT)
+	{
+		ft_memset(&table->phases[i], 0, sizeof(t_prof_hist));
+		table->phases[i].min = UINT64_MAX;
+		i++;
+	}
+	ft_memset(table->children, 0, sizeof(table->children));
+}
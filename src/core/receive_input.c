@@ -12,132 +12,148 @@
 
 #include "minishell.h"
 #include "parser/parser_input_check.h"
+#include "core/profile.h"
 
 bool	is_sigint_received(void);
 void	clear_sigint(void);
 void	ft_putstr_fd(const char *s, int fd);
-bool	validate_input(char *input);
+t_syntax_error	validate_timed_line(t_batch *batch, t_batch_line *line,
+					t_shell *shell, const char **token);
 void	handle_error(t_syntax_error error, t_shell *shell, const char *token);
 
 /**
- * @brief Tokenizes the user's input into an array of strings.
+ * @brief Checks whether a line must be skipped.
  * 
- * This function splits the user input into tokens using the tokenizer utility
- * functions, which consider special shell characters and syntax. If 
- * tokenization fails, an error message is displayed.
- * 
- * @param input The user input string to be tokenized.
- * @param shell A pointer to the shell structure containing
- * environment variables and exit status.
- * @return An array of strings representing the tokens, or NULL if 
- * tokenization fails.
- * 
- * @note Ensure the returned tokens array is freed after use to prevent 
- * memory leaks.
+ * @param line The line to check.
+ * @return True for blank lines and comments (first word starting with '#').
  */
-static char	**get_tokens(char *input, t_shell *shell)
+static bool	is_skipped_line(const char *line)
 {
-	char	**tokens;
-
-	tokens = tokenize_input(input, shell);
-	if (!tokens)
-		ft_error_msg(PARSER_ERR, "Failed to tokenize input");
-	return (tokens);
+	while (*line && ft_isspace(*line))
+		line++;
+	return (*line == '\0' || *line == '#');
 }
 
 /**
- * @brief Adds the user's input to the command history.
- * 
- * This function adds the given input string to the history using the readline
- * library. Input strings with a length of zero are ignored and not added.
+ * @brief Builds and executes the AST of one expanded command line.
  * 
- * @param input The user input string to be added to the history.
+ * Patterns are expanded first. A leading `time` keyword is stripped from
+ * the tokens and reported once the whole command line has finished. A line
+ * whose expansion failed is not run; the expansion already set the status.
  * 
- * @note This function uses the `add_history` function from 
- * the readline library.
+ * @param tokens The expanded, NULL-terminated tokens of the line.
+ * @param shell A pointer to the shell structure.
  */
-static void	add_input_to_history(char *input)
+static void	execute_line(char **tokens, t_shell *shell)
 {
-	if (ft_strlen(input) > 0)
-		add_history(input);
+	t_ast		ast;
+	t_time_ctx	timing;
+	size_t		skip;
+	char		**words;
+
+	if (shell->expand_error)
+	{
+		shell->expand_error = false;
+		return ;
+	}
+	words = expand_globs(tokens);
+	if (words)
+		tokens = words;
+	ast.root = NULL;
+	skip = time_begin(tokens, &timing, shell);
+	process_ast(tokens + skip, &ast, shell);
+	time_end(&timing, shell);
+	free_ast(&ast);
+	ast.root = NULL;
+	free_array(words);
 }
 
 /**
- * @brief Processes a single command by building an abstract syntax tree (AST).
- * 
- * This function processes a single command by tokenizing it, parsing the tokens
- * to build an abstract syntax tree (AST), and then freeing the tokens array.
- * 
- * @param command The command string to be processed.
- * @param shell A pointer to the shell structure containing environment 
- * variables.
- * 
- * @note This function uses the `process_ast` function to build the AST.
+ * @brief Validates, expands and executes one line of a batch.
+ * 
+ * Syntax errors are reported, set the exit status and skip the line only.
+ * A `time` keyword followed by an operator is one of them.
+ * In a script, the heredoc bodies that follow the line are taken from the
+ * batch first, and skipped.
+ * 
+ * @param batch The lexed batch.
+ * @param index The index of the line to run.
+ * @param scratch Array receiving the expanded tokens, grown as needed.
+ * @param shell A pointer to the shell structure.
+ * @return The index of the next line to run.
  */
-static void	process_single_command(char *command, t_shell *shell)
+static size_t	run_line(t_batch *batch, size_t index, t_str_vec *scratch,
+	t_shell *shell)
 {
-	t_ast	ast;
-	char	**tokens;
+	t_batch_line	*line;
+	t_syntax_error	error;
+	const char		*token;
+	uint64_t		start;
+	size_t			next;
 
-	ast.root = NULL;
-	tokens = get_tokens(command, shell);
-	if (tokens)
+	line = &batch->lines[index];
+	next = index + 1;
+	if (is_skipped_line(line->source))
+		return (next);
+	if (!shell->interactive)
+		next = collect_heredoc_bodies(batch, index, shell);
+	start = prof_start();
+	error = validate_timed_line(batch, line, shell, &token);
+	prof_stop(PROF_VALIDATE, start);
+	if (error == SYNTAX_OK)
 	{
-		process_ast(tokens, &ast, shell);
-		free_tokens_array(tokens, -1);
+		expand_batch_line(batch->tokens + line->first, line->count, scratch,
+			shell);
+		execute_line(scratch->items, shell);
+		release_batch_line(batch->tokens + line->first, line->count, scratch);
 	}
-	free_ast(&ast);
-	ast.root = NULL;
+	else if (error != SYNTAX_EMPTY)
+		handle_error(error, shell, token);
+	return (release_heredoc_bodies(shell), next);
 }
 
 /**
- * @brief Processes the user's input by tokenizing and parsing it.
+ * @brief Runs a chunk of input (one or more lines).
  * 
- * This function processes the user's input by tokenizing it into an array of
- * strings and then parsing the tokens to build an abstract syntax tree (AST).
- * If the input is empty, the function returns without processing it.
+ * The whole input is lexed once into a batch backed by a single arena,
+ * then every line is validated, expanded and executed in order. Expansion
+ * is done per line, right before the line runs, so it sees the variables
+ * set by the previous lines. It is shared by the interactive loop and the
+ * script mode.
  * 
- * @param input The user input string to be processed.
+ * @param input The input string, modified in place.
  * @param shell A pointer to the shell structure containing environment 
  * variables.
- * 
- * @note This function uses the `process_ast` function to build the AST.
  */
-static void	process_input(char *input, t_shell *shell)
+void	run_input(char *input, t_shell *shell)
 {
-	char	*command;
-	char	*saveptr;
-	char	*cmd_copy;
+	t_batch		batch;
+	t_str_vec	scratch;
+	size_t		i;
 
-	command = ft_strtok_r(input, "\n", &saveptr);
-	while (command)
-	{
-		if (ft_strlen(command) > 0)
-		{
-			cmd_copy = ft_strdup(command);
-			if (!cmd_copy)
-			{
-				ft_error_msg("Error", "Memory allocation failed");
-				return ;
-			}
-			process_single_command(cmd_copy, shell);
-			safe_free((void **) &cmd_copy);
-		}
-		command = ft_strtok_r(NULL, "\n", &saveptr);
-	}
+	if (!tokenize_batch(input, &batch))
+		return ;
+	scratch.count = 0;
+	scratch.capacity = batch.max_count + 1;
+	scratch.items = safe_malloc(scratch.capacity * sizeof(char *));
+	i = 0;
+	while (scratch.items && i < batch.line_count)
+		i = run_line(&batch, i, &scratch, shell);
+	safe_free((void **)&scratch.items);
+	free_batch(&batch);
 }
 
 /**
  * @brief Processes user input in the interactive shell.
  * 
- * This function reads user input using the readline library and processes it
- * by calling the `process_input` function. If the input is empty, the function
- * returns 0 to exit the shell. If the user sends a SIGINT signal, the function
- * returns 1 to continue the shell loop.
+ * This function reads user input using the readline library, adds it to the
+ * history and runs it with `run_input`. If the input is empty (EOF), the
+ * function returns false to exit the shell.
  * 
  * @param shell A pointer to the shell structure containing environment 
  * variables.
- * @return 1 if the shell loop should continue, 0 if the shell should exit.
+ * @return true if the shell loop should continue, false if the shell
+ * should exit.
  * 
  * @note This function uses the `readline` function from the readline library.
  * The input string is freed after use to prevent memory leaks.
@@ -145,26 +161,14 @@ static void	process_input(char *input, t_shell *shell)
  */
 bool	receive_input(t_shell *shell)
 {
-	char			*input;
-	t_syntax_error	error;
+	char	*input;
 
 	input = readline("minishell$ ");
 	if (!input)
 		return (false);
-	add_input_to_history(input);
-	error = validate_input(input);
-	if (error == SYNTAX_EMPTY)
-	{
-		safe_free((void **) &input);
-		return (true);
-	}
-	else if (error != SYNTAX_OK)
-	{
-		handle_error(error, shell, NULL);
-		safe_free((void **) &input);
-		return (true);
-	}
-	process_input(input, shell);
+	if (ft_strlen(input) > 0)
+		add_history(input);
+	run_input(input, shell);
 	safe_free((void **) &input);
 	return (true);
 }
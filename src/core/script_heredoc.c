@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_heredoc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:21:37 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:21:37 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file script_heredoc.c
+ * @brief Heredoc bodies of a script.
+ * 
+ * In a script, the body of a heredoc is made of the lines that follow its
+ * command line, up to the delimiter. They are already in the batch, so they
+ * are gathered before the line runs and handed to the executor through
+ * shell->heredoc_bodies, which serves them without forking a reader. The
+ * body lines and the delimiters are then skipped.
+ */
+
+#include "minishell.h"
+#include "core/arena.h"
+
+/**
+ * @brief Counts the heredoc operators of a line.
+ * 
+ * @param tokens The NULL-terminated tokens of the line, as lexed.
+ * @return The number of `<<` tokens followed by a delimiter.
+ */
+static size_t	count_heredocs(char **tokens)
+{
+	size_t	count;
+
+	count = 0;
+	while (*tokens)
+	{
+		if (ft_strcmp(skip_fd_prefix(*tokens), "<<") == 0 && tokens[1])
+			count++;
+		tokens++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Joins lines [first, end) of a batch into one heredoc body.
+ * 
+ * @param batch The batch, whose arena holds the body.
+ * @param first The first line of the body.
+ * @param end The line after the body.
+ * @return The body, each line followed by a newline, or NULL.
+ */
+static char	*join_lines(t_batch *batch, size_t first, size_t end)
+{
+	char	*body;
+	size_t	len;
+	size_t	i;
+
+	len = 0;
+	i = first;
+	while (i < end)
+		len += ft_strlen(batch->lines[i++].source) + 1;
+	body = arena_alloc(&batch->arena, len + 1);
+	if (!body)
+		return (NULL);
+	len = 0;
+	while (first < end)
+	{
+		i = ft_strlen(batch->lines[first].source);
+		ft_memcpy(body + len, batch->lines[first++].source, i);
+		body[len + i] = '\n';
+		len += i + 1;
+	}
+	body[len] = '\0';
+	return (body);
+}
+
+/**
+ * @brief Reads the body of one heredoc from the following lines.
+ * 
+ * A body that is not terminated by its delimiter runs up to the end of
+ * the input, with a warning. The empty line after the final newline of
+ * the input is not part of it.
+ * 
+ * @param batch The batch.
+ * @param next Address of the first line of the body, moved past it.
+ * @param delimiter The raw delimiter token.
+ * @return The body, or NULL on allocation failure.
+ */
+static char	*read_body(t_batch *batch, size_t *next, char *delimiter)
+{
+	char	*word;
+	char	*body;
+	size_t	end;
+	size_t	last;
+
+	word = handle_quotes(delimiter);
+	if (!word)
+		return (NULL);
+	last = batch->line_count;
+	if (last > *next && batch->lines[last - 1].source[0] == '\0')
+		last--;
+	end = *next;
+	while (end < last && ft_strcmp(batch->lines[end].source, word) != 0)
+		end++;
+	if (end == last)
+		heredoc_eof_warning(word);
+	free(word);
+	body = join_lines(batch, *next, end);
+	*next = end + (end < last);
+	return (body);
+}
+
+/**
+ * @brief Gathers the heredoc bodies of a script line.
+ * 
+ * @param batch The batch.
+ * @param line The index of the line about to run.
+ * @param shell The shell structure, whose heredoc_bodies is set.
+ * @return The index of the line to run after this one.
+ */
+size_t	collect_heredoc_bodies(t_batch *batch, size_t line, t_shell *shell)
+{
+	char	**tokens;
+	size_t	next;
+	size_t	count;
+
+	next = line + 1;
+	tokens = batch->tokens + batch->lines[line].first;
+	count = count_heredocs(tokens);
+	if (count == 0)
+		return (next);
+	shell->heredoc_bodies = safe_malloc((count + 1) * sizeof(char *));
+	shell->heredoc_next = 0;
+	if (!shell->heredoc_bodies)
+		return (next);
+	count = 0;
+	while (*tokens)
+	{
+		if (ft_strcmp(skip_fd_prefix(*tokens), "<<") == 0 && tokens[1])
+			shell->heredoc_bodies[count++] = read_body(batch, &next,
+					tokens[1]);
+		tokens++;
+	}
+	shell->heredoc_bodies[count] = NULL;
+	return (next);
+}
+
+/**
+ * @brief Drops the heredoc bodies of the line that just ran.
+ * 
+ * The bodies themselves live in the batch arena.
+ * 
+ * @param shell The shell structure.
+ */
+void	release_heredoc_bodies(t_shell *shell)
+{
+	safe_free((void **)&shell->heredoc_bodies);
+	shell->heredoc_next = 0;
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_mode.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:31:16 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 12:31:16 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file script_mode.c
+ * @brief Non-interactive execution of a script file.
+ * 
+ * `minishell path` reads the whole file at once and runs it as a single
+ * batch through run_input, the same path as the interactive loop: the body
+ * is lexed once and its lines are executed in order. Empty lines and lines
+ * starting with '#' (including a shebang) are skipped. The shell exits
+ * with the status of the last command.
+ */
+
+#include "minishell.h"
+#include "core/core.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+void	quit_shell(t_shell *shell);
+
+/**
+ * @brief Reads a descriptor up to its end into a dynamic buffer.
+ * 
+ * The data is read straight into the free space of the buffer, which is
+ * doubled whenever EXEC_BUFFER_SIZE bytes or less are left: each read asks
+ * for as much as the buffer can hold, so the reads grow with the input and
+ * nothing is copied except when the buffer is reallocated.
+ * 
+ * @param fd The file descriptor to read from.
+ * @param buffer An initialized buffer that receives the contents.
+ * @return True on success, false on read or allocation error.
+ */
+bool	read_all_fd(int fd, t_dynamic_buffer *buffer)
+{
+	ssize_t	bytes;
+
+	bytes = 1;
+	while (bytes > 0)
+	{
+		while (buffer->capacity - buffer->size <= EXEC_BUFFER_SIZE)
+		{
+			if (!expand_buffer(buffer))
+				return (false);
+		}
+		bytes = read(fd, buffer->data + buffer->size,
+				buffer->capacity - buffer->size - 1);
+		if (bytes > 0)
+			buffer->size += bytes;
+	}
+	buffer->data[buffer->size] = '\0';
+	return (bytes == 0);
+}
+
+/**
+ * @brief Reports a script that cannot be opened or read and exits.
+ * 
+ * @param path The path of the script.
+ * @param shell The shell structure.
+ */
+static void	script_error(const char *path, t_shell *shell)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(path, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(strerror(errno), STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	shell->exit_status = 127;
+	quit_shell(shell);
+}
+
+/**
+ * @brief Runs a script file and exits the shell.
+ * 
+ * @param path The path of the script.
+ * @param shell The shell structure.
+ */
+void	run_script(const char *path, t_shell *shell)
+{
+	t_dynamic_buffer	buffer;
+	int					fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		script_error(path, shell);
+	if (!init_buffer(&buffer, EXEC_BUFFER_SIZE) || !read_all_fd(fd, &buffer))
+	{
+		close(fd);
+		script_error(path, shell);
+	}
+	close(fd);
+	run_input(buffer.data, shell);
+	free_buffer(&buffer);
+	quit_shell(shell);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:33:41 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:33:41 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith.c
+ * @brief Entry point of the arithmetic evaluator and its error reporting.
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Skips the blanks at the current position.
+ * 
+ * @param a The evaluation.
+ */
+void	arith_skip_spaces(t_arith *a)
+{
+	while (ft_isspace(*a->ptr))
+		a->ptr++;
+}
+
+/**
+ * @brief Records the first error of an evaluation.
+ * 
+ * @param a The evaluation.
+ * @param message The error message.
+ * @return false, so that callers can return it directly.
+ */
+bool	arith_fail(t_arith *a, const char *message)
+{
+	if (!a->error)
+	{
+		a->error = message;
+		a->error_at = a->ptr;
+	}
+	return (false);
+}
+
+/**
+ * @brief Writes the decimal form of a value.
+ * 
+ * @param value The value.
+ * @param out Buffer of at least ARITH_NUM_SIZE bytes.
+ * @return The length written, without the NUL.
+ */
+size_t	arith_format(int64_t value, char *out)
+{
+	char		digits[ARITH_NUM_SIZE];
+	uint64_t	n;
+	size_t		len;
+	size_t		i;
+
+	n = (uint64_t)value;
+	if (value < 0)
+		n = 0 - n;
+	len = 0;
+	digits[len++] = '0' + n % 10;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits[len++] = '0' + n % 10;
+	}
+	i = 0;
+	if (value < 0)
+		out[i++] = '-';
+	while (len > 0)
+		out[i++] = digits[--len];
+	out[i] = '\0';
+	return (i);
+}
+
+/**
+ * @brief Prints the error of an evaluation, bash style.
+ * 
+ * @param a The evaluation.
+ */
+static void	report_error(t_arith *a)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(a->expr, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(a->error, STDERR_FILENO);
+	if (a->error_at && *a->error_at)
+	{
+		ft_putstr_fd(" (error token is \"", STDERR_FILENO);
+		ft_putstr_fd(a->error_at, STDERR_FILENO);
+		ft_putstr_fd("\")", STDERR_FILENO);
+	}
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Evaluates an arithmetic expression.
+ * 
+ * An empty expression is 0. Errors are reported on the standard error.
+ * 
+ * @param expr The expression, already expanded.
+ * @param shell The shell, whose variables the expression uses.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_eval(const char *expr, t_shell *shell, int64_t *value)
+{
+	t_arith	a;
+
+	a.expr = expr;
+	a.ptr = expr;
+	a.shell = shell;
+	a.error = NULL;
+	a.error_at = NULL;
+	a.skip = 0;
+	a.depth = 0;
+	*value = 0;
+	arith_skip_spaces(&a);
+	if (*a.ptr == '\0')
+		return (true);
+	if (arith_comma(&a, value) && *a.ptr != '\0')
+		arith_fail(&a, "syntax error in expression");
+	if (!a.error)
+		return (true);
+	report_error(&a);
+	return (false);
+}
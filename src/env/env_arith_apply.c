@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_apply.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:39:50 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:39:50 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith_apply.c
+ * @brief Application of the binary arithmetic operators.
+ * 
+ * Additions, subtractions, multiplications, powers and left shifts are
+ * done on unsigned values, so that an overflow wraps around instead of
+ * being undefined. Shift counts are taken modulo 64.
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Raises base to a non-negative power, by squaring.
+ * 
+ * @param base The base.
+ * @param exp The exponent.
+ * @return The power, wrapped around on overflow.
+ */
+static int64_t	arith_pow(int64_t base, int64_t exp)
+{
+	uint64_t	result;
+	uint64_t	factor;
+
+	result = 1;
+	factor = (uint64_t)base;
+	while (exp > 0)
+	{
+		if (exp & 1)
+			result *= factor;
+		factor *= factor;
+		exp >>= 1;
+	}
+	return ((int64_t)result);
+}
+
+/**
+ * @brief Applies `/` or `%`.
+ * 
+ * INT64_MIN / -1 overflows: it gives INT64_MIN and the remainder 0.
+ * 
+ * @param a The evaluation.
+ * @param op ARITH_DIV or ARITH_MOD.
+ * @param left The left operand, replaced by the result.
+ * @param right The right operand.
+ * @return false on a division by 0 outside a skipped branch.
+ */
+static bool	arith_divide(t_arith *a, t_arith_op op, int64_t *left,
+	int64_t right)
+{
+	if (right == 0 && !a->skip)
+		return (arith_fail(a, "division by 0"));
+	if (right == 0)
+		*left = 0;
+	else if (right == -1 && *left == INT64_MIN && op == ARITH_MOD)
+		*left = 0;
+	else if (right == -1 && *left == INT64_MIN)
+		*left = INT64_MIN;
+	else if (op == ARITH_DIV)
+		*left /= right;
+	else
+		*left %= right;
+	return (true);
+}
+
+/**
+ * @brief Applies a logical or comparison operator.
+ * 
+ * @param op The operator.
+ * @param l The left operand.
+ * @param r The right operand.
+ * @return 1 if true, 0 otherwise.
+ */
+static int64_t	arith_compare(t_arith_op op, int64_t l, int64_t r)
+{
+	if (op == ARITH_LOR)
+		return (l || r);
+	if (op == ARITH_LAND)
+		return (l && r);
+	if (op == ARITH_EQ)
+		return (l == r);
+	if (op == ARITH_NE)
+		return (l != r);
+	if (op == ARITH_LT)
+		return (l < r);
+	if (op == ARITH_LE)
+		return (l <= r);
+	if (op == ARITH_GT)
+		return (l > r);
+	return (l >= r);
+}
+
+/**
+ * @brief Applies a bitwise or shift operator.
+ * 
+ * @param op The operator.
+ * @param l The left operand.
+ * @param r The right operand.
+ * @return The result.
+ */
+static int64_t	arith_bitwise(t_arith_op op, int64_t l, int64_t r)
+{
+	if (op == ARITH_BOR)
+		return (l | r);
+	if (op == ARITH_BXOR)
+		return (l ^ r);
+	if (op == ARITH_BAND)
+		return (l & r);
+	if (op == ARITH_SHL)
+		return ((int64_t)((uint64_t)l << (r & 63)));
+	return (l >> (r & 63));
+}
+
+/**
+ * @brief Applies a binary operator.
+ * 
+ * @param a The evaluation.
+ * @param op The operator.
+ * @param left The left operand, replaced by the result.
+ * @param right The right operand.
+ * @return false on error (division by 0, negative exponent).
+ */
+bool	arith_apply(t_arith *a, t_arith_op op, int64_t *left, int64_t right)
+{
+	if (op == ARITH_LOR || op == ARITH_LAND
+		|| (op >= ARITH_EQ && op <= ARITH_GE))
+		*left = arith_compare(op, *left, right);
+	else if (op == ARITH_BOR || op == ARITH_BXOR || op == ARITH_BAND
+		|| op == ARITH_SHL || op == ARITH_SHR)
+		*left = arith_bitwise(op, *left, right);
+	else if (op == ARITH_ADD)
+		*left = (int64_t)((uint64_t)*left + (uint64_t)right);
+	else if (op == ARITH_SUB)
+		*left = (int64_t)((uint64_t)*left - (uint64_t)right);
+	else if (op == ARITH_MUL)
+		*left = (int64_t)((uint64_t)*left * (uint64_t)right);
+	else if (op == ARITH_POW && right < 0 && !a->skip)
+		return (arith_fail(a, "exponent less than 0"));
+	else if (op == ARITH_POW)
+		*left = arith_pow(*left, right);
+	else
+		return (arith_divide(a, op, left, right));
+	return (true);
+}
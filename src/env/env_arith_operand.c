@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_operand.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:31:29 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:31:29 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith_operand.c
+ * @brief Operands of arithmetic expressions: parentheses, numbers and
+ * variables.
+ * 
+ * Numbers are decimal, hexadecimal after `0x`, octal after a leading `0`,
+ * or written `base#digits` with a base from 2 to 64 (digits, then
+ * lowercase, uppercase, `@` and `_`; letters are case-insensitive up to
+ * base 36).
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Returns the value of a digit in a base.
+ * 
+ * @param c The digit.
+ * @param base The base.
+ * @return The value, or -1 if c is not a digit character.
+ */
+static int	digit_value(char c, int base)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z' && base <= 36)
+		return (c - 'A' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 36);
+	if (c == '@')
+		return (62);
+	if (c == '_')
+		return (63);
+	return (-1);
+}
+
+/**
+ * @brief Reads the base of the number at the current position and moves
+ * past its prefix.
+ * 
+ * @param a The evaluation.
+ * @return The base, or 0 for an invalid `base#`.
+ */
+static int	number_base(t_arith *a)
+{
+	const char	*p;
+	int			base;
+
+	p = a->ptr;
+	base = 0;
+	while (ft_isdigit(*p) && base <= 64)
+	{
+		base = base * 10 + (*p - '0');
+		p++;
+	}
+	if (*p == '#')
+	{
+		a->ptr = p + 1;
+		if (base < 2 || base > 64)
+			return (0);
+		return (base);
+	}
+	if (a->ptr[0] == '0' && (a->ptr[1] == 'x' || a->ptr[1] == 'X'))
+	{
+		a->ptr += 2;
+		return (16);
+	}
+	if (a->ptr[0] == '0')
+		return (8);
+	return (10);
+}
+
+/**
+ * @brief Parses a number.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value, wrapped around on overflow.
+ * @return false on an invalid base or digit. The error token of a digit
+ * too great for the base is the whole number, as in bash.
+ */
+static bool	arith_number(t_arith *a, int64_t *value)
+{
+	const char	*start;
+	uint64_t	n;
+	int			base;
+	int			digit;
+
+	start = a->ptr;
+	base = number_base(a);
+	if (base == 0)
+		return (arith_fail(a, "invalid arithmetic base"));
+	n = 0;
+	digit = digit_value(*a->ptr, base);
+	while (digit >= 0)
+	{
+		if (digit >= base)
+		{
+			a->ptr = start;
+			return (arith_fail(a, "value too great for base"));
+		}
+		n = n * base + digit;
+		a->ptr++;
+		digit = digit_value(*a->ptr, base);
+	}
+	*value = (int64_t)n;
+	return (true);
+}
+
+/**
+ * @brief Reads a variable, incremented or decremented before (step) or
+ * after (`name++`, `name--`) its value is taken.
+ * 
+ * @param a The evaluation, at the name.
+ * @param len The length of the name.
+ * @param step 1 for `++name`, -1 for `--name`, 0 otherwise.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+static bool	arith_variable(t_arith *a, size_t len, int step, int64_t *value)
+{
+	const char	*name;
+
+	name = a->ptr;
+	a->ptr += len;
+	if (!arith_load(a, name, len, value))
+		return (false);
+	if (step != 0)
+	{
+		*value = (int64_t)((uint64_t)*value + (int64_t)step);
+		return (arith_store(a, name, len, *value));
+	}
+	arith_skip_spaces(a);
+	if ((a->ptr[0] == '+' || a->ptr[0] == '-') && a->ptr[1] == a->ptr[0])
+	{
+		step = 1 - 2 * (a->ptr[0] == '-');
+		a->ptr += 2;
+		return (arith_store(a, name, len,
+				(int64_t)((uint64_t)*value + (int64_t)step)));
+	}
+	return (true);
+}
+
+/**
+ * @brief Parses an operand: `(expr)`, a number or a variable.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_operand(t_arith *a, int64_t *value)
+{
+	size_t	len;
+	int		step;
+
+	arith_skip_spaces(a);
+	if (*a->ptr == '(')
+	{
+		a->ptr++;
+		if (!arith_comma(a, value))
+			return (false);
+		if (*a->ptr != ')')
+			return (arith_fail(a, "missing `)'"));
+		a->ptr++;
+		return (true);
+	}
+	if (ft_isdigit(*a->ptr))
+		return (arith_number(a, value));
+	step = 0;
+	if ((a->ptr[0] == '+' || a->ptr[0] == '-') && a->ptr[1] == a->ptr[0])
+		step = 1 - 2 * (a->ptr[0] == '-');
+	a->ptr += 2 * (step != 0);
+	len = arith_name_len(a->ptr);
+	if (len == 0)
+		return (arith_fail(a, "syntax error: operand expected"));
+	return (arith_variable(a, len, step, value));
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_ops.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:34:39 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:34:39 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith_ops.c
+ * @brief Recognition and precedence of the arithmetic operators.
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Tells whether s starts with prefix.
+ * 
+ * @param s The string.
+ * @param prefix The prefix.
+ * @return The length of prefix if it matches, 0 otherwise.
+ */
+static size_t	starts_with(const char *s, const char *prefix)
+{
+	size_t	i;
+
+	i = 0;
+	while (prefix[i] && s[i] == prefix[i])
+		i++;
+	if (prefix[i])
+		return (0);
+	return (i);
+}
+
+/**
+ * @brief Matches the binary operator at s, longest first.
+ * 
+ * @param s The expression, at an operator.
+ * @param len Receives the length of the operator.
+ * @return The operator, or ARITH_NONE.
+ */
+static t_arith_op	match_op(const char *s, size_t *len)
+{
+	static const char		*names[] = {"||", "&&", "|", "^", "&", "==",
+		"!=", "<=", "<<", "<", ">=", ">>", ">", "+", "-", "**", "*", "/",
+		"%", NULL};
+	static const t_arith_op	ops[] = {ARITH_LOR, ARITH_LAND, ARITH_BOR,
+		ARITH_BXOR, ARITH_BAND, ARITH_EQ, ARITH_NE, ARITH_LE, ARITH_SHL,
+		ARITH_LT, ARITH_GE, ARITH_SHR, ARITH_GT, ARITH_ADD, ARITH_SUB,
+		ARITH_POW, ARITH_MUL, ARITH_DIV, ARITH_MOD};
+	int						i;
+
+	i = 0;
+	while (names[i])
+	{
+		*len = starts_with(s, names[i]);
+		if (*len > 0)
+			return (ops[i]);
+		i++;
+	}
+	*len = 0;
+	return (ARITH_NONE);
+}
+
+/**
+ * @brief Returns the binary operator at s.
+ * 
+ * An operator followed by `=` (`+=`, `<<=`...) is an assignment, not a
+ * binary operator; `==`, `!=`, `<=` and `>=` end with their own `=`.
+ * 
+ * @param s The expression.
+ * @param len Receives the length of the operator.
+ * @return The operator, or ARITH_NONE.
+ */
+t_arith_op	arith_binary_op(const char *s, size_t *len)
+{
+	t_arith_op	op;
+
+	op = match_op(s, len);
+	if (op != ARITH_NONE && s[*len] == '=' && s[*len - 1] != '=')
+		return (ARITH_NONE);
+	return (op);
+}
+
+/**
+ * @brief Returns the assignment operator at s.
+ * 
+ * @param s The expression, after a variable name.
+ * @param len Receives the length of the operator.
+ * @param op Receives the operator combined with the assignment, or
+ * ARITH_NONE for `=`.
+ * @return true if s starts with an assignment operator.
+ */
+bool	arith_assign_op(const char *s, size_t *len, t_arith_op *op)
+{
+	*op = ARITH_NONE;
+	*len = 1;
+	if (s[0] == '=' && s[1] != '=')
+		return (true);
+	*op = match_op(s, len);
+	if (*op == ARITH_NONE || s[*len] != '=' || s[*len - 1] == '='
+		|| *op == ARITH_LOR || *op == ARITH_LAND || *op == ARITH_POW
+		|| (*op >= ARITH_EQ && *op <= ARITH_GE))
+		return (false);
+	(*len)++;
+	return (true);
+}
+
+/**
+ * @brief Returns the precedence of a binary operator.
+ * 
+ * @param op The operator.
+ * @return From 1 for `||` to 11 for `**`, 0 for ARITH_NONE.
+ */
+int	arith_precedence(t_arith_op op)
+{
+	static const int	precedence[] = {0, 1, 2, 3, 4, 5, 6, 6, 7, 7, 7, 7,
+		8, 8, 9, 9, 10, 10, 10, 11};
+
+	return (precedence[op]);
+}
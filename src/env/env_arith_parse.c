@@ -0,0 +1,196 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_parse.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:38:44 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:38:44 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith_parse.c
+ * @brief Grammar of arithmetic expressions, from `,` down to unary
+ * operators.
+ * 
+ * Binary operators are parsed by precedence climbing: an operand, then
+ * every operator binding at least as tight as the current level, each
+ * with a right operand parsed one level higher (at the same level for the
+ * right-associative `**`).
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Parses binary operators of precedence min_prec or higher.
+ * 
+ * The right operand of a `&&` or `||` whose result is already known is
+ * parsed in skip mode.
+ * 
+ * @param a The evaluation.
+ * @param min_prec The lowest precedence to take.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+static bool	arith_binary(t_arith *a, int min_prec, int64_t *value)
+{
+	t_arith_op	op;
+	size_t		len;
+	int64_t		right;
+	int			decided;
+
+	if (!arith_unary(a, value))
+		return (false);
+	arith_skip_spaces(a);
+	op = arith_binary_op(a->ptr, &len);
+	while (op != ARITH_NONE && arith_precedence(op) >= min_prec)
+	{
+		a->ptr += len;
+		decided = ((op == ARITH_LAND && !*value)
+				|| (op == ARITH_LOR && *value));
+		a->skip += decided;
+		if (!arith_binary(a, arith_precedence(op) + (op != ARITH_POW),
+				&right))
+			return (false);
+		a->skip -= decided;
+		if (!arith_apply(a, op, value, right))
+			return (false);
+		arith_skip_spaces(a);
+		op = arith_binary_op(a->ptr, &len);
+	}
+	return (true);
+}
+
+/**
+ * @brief Parses `cond ? then : else`, the branch not taken in skip mode.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+static bool	arith_ternary(t_arith *a, int64_t *value)
+{
+	int64_t	other;
+	int		cond;
+
+	if (!arith_binary(a, 1, value))
+		return (false);
+	if (*a->ptr != '?')
+		return (true);
+	a->ptr++;
+	cond = (*value != 0);
+	a->skip += !cond;
+	if (!arith_comma(a, value))
+		return (false);
+	a->skip -= !cond;
+	if (*a->ptr != ':')
+		return (arith_fail(a, "`:' expected for conditional expression"));
+	a->ptr++;
+	a->skip += cond;
+	if (!arith_assign(a, &other))
+		return (false);
+	a->skip -= cond;
+	if (!cond)
+		*value = other;
+	return (true);
+}
+
+/**
+ * @brief Parses an assignment (`name = expr`, `name += expr`...), or a
+ * conditional expression when no assignment operator follows a name.
+ * 
+ * Assignments are right-associative: `a = b = 1` sets both.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_assign(t_arith *a, int64_t *value)
+{
+	const char	*name;
+	size_t		name_len;
+	size_t		op_len;
+	t_arith_op	op;
+	int64_t		right;
+
+	arith_skip_spaces(a);
+	name = a->ptr;
+	name_len = arith_name_len(name);
+	a->ptr += name_len;
+	arith_skip_spaces(a);
+	if (name_len == 0 || !arith_assign_op(a->ptr, &op_len, &op))
+	{
+		a->ptr = name;
+		return (arith_ternary(a, value));
+	}
+	a->ptr += op_len;
+	if (!arith_assign(a, &right))
+		return (false);
+	*value = right;
+	if (op != ARITH_NONE && (!arith_load(a, name, name_len, value)
+			|| !arith_apply(a, op, value, right)))
+		return (false);
+	return (arith_store(a, name, name_len, *value));
+}
+
+/**
+ * @brief Parses a comma-separated list; its value is the last one.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_comma(t_arith *a, int64_t *value)
+{
+	if (!arith_assign(a, value))
+		return (false);
+	arith_skip_spaces(a);
+	while (*a->ptr == ',')
+	{
+		a->ptr++;
+		if (!arith_assign(a, value))
+			return (false);
+		arith_skip_spaces(a);
+	}
+	return (true);
+}
+
+/**
+ * @brief Parses the unary operators `+`, `-`, `!` and `~`, then an
+ * operand. `++` or `--` right before a name is an increment, left to the
+ * operand.
+ * 
+ * @param a The evaluation.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_unary(t_arith *a, int64_t *value)
+{
+	char	op;
+
+	arith_skip_spaces(a);
+	op = *a->ptr;
+	a->depth++;
+	if (a->depth > ARITH_MAX_DEPTH)
+		return (arith_fail(a, "expression recursion level exceeded"));
+	if (op && ft_strchr("+-!~", op) && !((op == '+' || op == '-')
+			&& a->ptr[1] == op && arith_name_len(a->ptr + 2) > 0))
+	{
+		a->ptr++;
+		if (!arith_unary(a, value))
+			return (false);
+		if (op == '-')
+			*value = (int64_t)(0 - (uint64_t)*value);
+		else if (op == '!')
+			*value = !*value;
+		else if (op == '~')
+			*value = ~*value;
+	}
+	else if (!arith_operand(a, value))
+		return (false);
+	a->depth--;
+	return (true);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_arith_vars.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:39:44 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:39:44 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_arith_vars.c
+ * @brief Variables read and written by arithmetic expressions.
+ */
+
+#include "minishell.h"
+#include "env/env_arith.h"
+
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Returns the length of the variable name at s.
+ * 
+ * @param s The expression.
+ * @return The length, 0 if s does not start with a name.
+ */
+size_t	arith_name_len(const char *s)
+{
+	size_t	len;
+
+	if (!ft_isalpha(*s) && *s != '_')
+		return (0);
+	len = 1;
+	while (ft_isalnum(s[len]) || s[len] == '_')
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Evaluates the text of a variable as an expression, as bash does
+ * (`a=b+1; b=2; echo $((a))` prints 3).
+ * 
+ * The text is copied, since the expression may assign the variable.
+ * 
+ * @param a The evaluation.
+ * @param text The value of the variable.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+static bool	eval_text(t_arith *a, const char *text, int64_t *value)
+{
+	t_arith	sub;
+	char	*copy;
+	bool	ok;
+
+	copy = ft_strdup(text);
+	if (!copy)
+		return (arith_fail(a, "out of memory"));
+	sub = *a;
+	sub.expr = copy;
+	sub.ptr = copy;
+	sub.error = NULL;
+	ok = arith_comma(&sub, value);
+	if (ok && *sub.ptr != '\0')
+		ok = arith_fail(&sub, "syntax error in expression");
+	free(copy);
+	if (!ok)
+		return (arith_fail(a, sub.error));
+	return (true);
+}
+
+/**
+ * @brief Reads a variable; unset or empty, it is 0.
+ * 
+ * @param a The evaluation.
+ * @param name The name, not NUL-terminated.
+ * @param len The length of the name.
+ * @param value Receives the value.
+ * @return true on success.
+ */
+bool	arith_load(t_arith *a, const char *name, size_t len, int64_t *value)
+{
+	char	*key;
+	char	*text;
+
+	*value = 0;
+	key = ft_strndup(name, len);
+	if (!key)
+		return (arith_fail(a, "out of memory"));
+	text = get_env_value(key, a->shell->env);
+	free(key);
+	if (!text || !*text)
+		return (true);
+	return (eval_text(a, text, value));
+}
+
+/**
+ * @brief Assigns a variable, unless the expression is being skipped.
+ * 
+ * A variable it creates is a shell variable, not exported.
+ * 
+ * @param a The evaluation.
+ * @param name The name, not NUL-terminated.
+ * @param len The length of the name.
+ * @param value The value.
+ * @return true on success.
+ */
+bool	arith_store(t_arith *a, const char *name, size_t len, int64_t value)
+{
+	char	*key;
+	char	num[ARITH_NUM_SIZE];
+	bool	result;
+
+	if (a->skip)
+		return (true);
+	key = ft_strndup(name, len);
+	if (!key)
+		return (arith_fail(a, "out of memory"));
+	if (env_is_readonly(a->shell->env, key))
+		return (free(key), arith_fail(a, "readonly variable"));
+	arith_format(value, num);
+	result = env_assign(&a->shell->env, key, num, 0);
+	free(key);
+	if (!result)
+		return (arith_fail(a, "cannot assign"));
+	return (true);
+}
@@ -27,7 +27,7 @@ char	*join_key_value(const char *key, const char *value);
 void	free_envp_on_error(char **envp, int i);
 
 /**
- * @brief Counts the number of nodes in the environment linked list.
+ * @brief Counts the exported nodes in the environment linked list.
  * 
  * @param env Pointer to the head of the environment linked list.
  * @return The number of nodes in the linked list.
@@ -41,7 +41,8 @@ static int	count_env_nodes(t_env *env)
 	temp = env;
 	while (temp)
 	{
-		count++;
+		if (temp->flags & ENV_EXPORTED)
+			count++;
 		temp = temp->next;
 	}
 	return (count);
@@ -81,7 +82,7 @@ static int	populate_envp(t_env *env, char **envp)
 	temp = env;
 	while (temp)
 	{
-		if (temp->key && temp->value)
+		if (temp->key && temp->value && (temp->flags & ENV_EXPORTED))
 		{
 			envp[i] = join_key_value(temp->key, temp->value);
 			if (!envp[i])
@@ -101,7 +102,8 @@ static int	populate_envp(t_env *env, char **envp)
  * @brief Converts a linked list of environment variables to an array of strings.
  * 
  * This function creates an array of strings where each string is in the format
- * "key=value". The array is NULL-terminated.
+ * "key=value". The array is NULL-terminated. Only the exported variables
+ * are in it: the shell variables stay in the shell.
  * 
  * @param env Pointer to the head of the environment linked list.
  * @return A pointer to the newly allocated environment array, or NULL 
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_assign.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:18:44 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 02:18:44 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_assign.c
+ * @brief Assignments to shell variables and their attributes.
+ * 
+ * A variable set by `name=value` is a shell variable: it is in the list,
+ * but not exported to the commands run until `export` gives it the
+ * ENV_EXPORTED flag. A variable with the ENV_READONLY flag can no longer
+ * be assigned or unset.
+ */
+
+#include "env/env.h"
+
+char	*handle_quotes(char *arg);
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Tells whether a word is an assignment, `name=value` with a
+ * valid name.
+ * 
+ * @param word The word.
+ * @return The length of the name, or 0 if the word is no assignment.
+ */
+size_t	env_assignment_len(const char *word)
+{
+	size_t	i;
+
+	if (!word || !(ft_isalpha(word[0]) || word[0] == '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(word[i]) || word[i] == '_')
+		i++;
+	if (word[i] != '=')
+		return (0);
+	return (i);
+}
+
+/**
+ * @brief Reports an assignment to a readonly variable, if name is one.
+ * 
+ * @param env The environment list.
+ * @param name The name of the variable.
+ * @return true if the variable is readonly.
+ */
+bool	env_readonly(t_env *env, const char *name)
+{
+	if (!env_is_readonly(env, name))
+		return (false);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(name, STDERR_FILENO);
+	ft_putstr_fd(": readonly variable\n", STDERR_FILENO);
+	return (true);
+}
+
+/**
+ * @brief Sets a variable and adds attributes to it.
+ * 
+ * A new variable gets only the given flags: an assignment with no flag
+ * makes a shell variable, while one to an exported variable keeps it
+ * exported. Only a value is refused to a readonly variable: `export`
+ * can still add ENV_EXPORTED to it.
+ * 
+ * @param env The environment list.
+ * @param name The name of the variable.
+ * @param value The value, copied, or NULL to keep the current one.
+ * @param flags The ENV_EXPORTED and ENV_READONLY flags to add.
+ * @return false if the variable is readonly (reported) or on allocation
+ * failure.
+ */
+bool	env_assign(t_env **env, const char *name, const char *value,
+	int flags)
+{
+	t_env	*node;
+
+	if (value && env_readonly(*env, name))
+		return (false);
+	node = env_own(*env, name);
+	if (node && ft_strcmp(node->key, name) == 0)
+	{
+		if (value)
+			env_str_set(&node->value, env_str_new(value));
+		node->flags |= flags;
+		return (!value || node->value);
+	}
+	if (!node && *env)
+		return (false);
+	node = initialize_env_node(name, value);
+	if (!node)
+		return (false);
+	node->flags = flags;
+	if (!*env)
+		*env = node;
+	else
+		env_own(*env, NULL)->next = node;
+	return (true);
+}
+
+/**
+ * @brief Runs an assignment word, removing the quotes of the value.
+ * 
+ * @param env The environment list.
+ * @param word The word, `name=value`.
+ * @param flags The flags to add to the variable.
+ * @return false on failure, reported.
+ */
+bool	env_assign_word(t_env **env, const char *word, int flags)
+{
+	size_t	len;
+	char	*name;
+	char	*value;
+	bool	done;
+
+	len = env_assignment_len(word);
+	name = ft_strndup(word, len);
+	value = handle_quotes((char *)word + len + 1);
+	if (!name || !value)
+	{
+		free(name);
+		free(value);
+		return (false);
+	}
+	done = env_assign(env, name, value, flags);
+	free(name);
+	free(value);
+	return (done);
+}
+
+/**
+ * @brief Gives back to a variable the value and flags it has in another
+ * list, or unsets it if it is not in that list.
+ * 
+ * Used to undo the assignments made for a single command. The readonly
+ * flag does not prevent it.
+ * 
+ * @param env The environment list.
+ * @param old The list to take the variable from, such as a snapshot of
+ * env taken before the assignments.
+ * @param name The name of the variable.
+ */
+void	env_restore(t_env **env, t_env *old, const char *name)
+{
+	t_env	*from;
+	t_env	*node;
+
+	from = find_env_variable(old, name);
+	if (!from)
+	{
+		*env = env_remove_node(*env, name);
+		return ;
+	}
+	node = env_own(*env, name);
+	if (!node || ft_strcmp(node->key, name) != 0)
+		return ;
+	env_str_set(&node->value, env_str_ref(from->value));
+	node->flags = from->flags;
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:05:17 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 19:05:17 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_brace.c
+ * @brief Brace expansion of the words of a command line.
+ * 
+ * A word with an unquoted `{...}` holding a comma at its top level, or a
+ * range such as `{1..5}`, is replaced by one word per item, in order,
+ * with the text around the braces kept: `a{b,c}d` gives `abd acd`.
+ * Groups are expanded from left to right and nested groups recursively.
+ * A brace that opens no such group (`{}`, `{a}`) is left as is.
+ */
+
+#include "minishell.h"
+#include "env/env_brace.h"
+
+/**
+ * @brief Skips the quoted text, escaped character or `${...}` / `$(...)`
+ * starting at s[i], in which braces and commas do not count.
+ * 
+ * @param s The word.
+ * @param i The index of the current character.
+ * @return The index of the next character to look at.
+ */
+static size_t	brace_skip(const char *s, size_t i)
+{
+	char	quote;
+	size_t	len;
+
+	if (s[i] == '\\' && s[i + 1])
+		return (i + 2);
+	if (s[i] == '$')
+	{
+		len = dollar_subst_len(s + i);
+		if (len > 0)
+			return (i + len);
+	}
+	if (s[i] != '\'' && s[i] != '"')
+		return (i + 1);
+	quote = s[i++];
+	while (s[i] && s[i] != quote)
+		i++;
+	if (s[i])
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Finds the brace that closes the one at s[open].
+ * 
+ * @param s The word.
+ * @param open The index of the opening brace.
+ * @param comma Set when the group has a comma at its top level.
+ * @return The index of the closing brace, or 0 if there is none.
+ */
+static size_t	brace_close(const char *s, size_t open, bool *comma)
+{
+	size_t	i;
+	int		depth;
+
+	*comma = false;
+	depth = 1;
+	i = open + 1;
+	while (s[i])
+	{
+		depth += (s[i] == '{') - (s[i] == '}');
+		if (depth == 0)
+			return (i);
+		if (s[i] == ',' && depth == 1)
+			*comma = true;
+		i = brace_skip(s, i);
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds the first brace group of a word that is expanded.
+ * 
+ * @param s The word.
+ * @param b Filled with the group.
+ * @return true if the word has one.
+ */
+bool	brace_find(const char *s, t_brace *b)
+{
+	size_t	i;
+	bool	comma;
+
+	i = 0;
+	while (s[i])
+	{
+		if (s[i] == '{')
+		{
+			b->open = i;
+			b->width = 0;
+			b->close = brace_close(s, i, &comma);
+			b->is_range = !comma && b->close > 0
+				&& brace_range_parse(s + i + 1, b->close - i - 1, b);
+			if (b->close > 0 && (comma || b->is_range))
+				return (true);
+		}
+		i = brace_skip(s, i);
+	}
+	return (false);
+}
+
+/**
+ * @brief Expands a group of comma-separated words, one after the other.
+ * 
+ * @param word The word, freed.
+ * @param b Its first group.
+ * @param out The new words.
+ * @return false on allocation failure.
+ */
+static bool	brace_list(char *word, t_brace *b, t_str_vec *out)
+{
+	size_t	start;
+	size_t	i;
+	int		depth;
+	bool	ok;
+
+	start = b->open + 1;
+	i = start;
+	depth = 0;
+	ok = true;
+	while (ok && i <= b->close)
+	{
+		if (i == b->close || (word[i] == ',' && depth == 0))
+		{
+			ok = brace_expand(brace_splice(word, b, word + start, i - start),
+					out);
+			start = i + 1;
+		}
+		depth += (word[i] == '{') - (word[i] == '}');
+		i = brace_skip(word, i);
+	}
+	free(word);
+	return (ok);
+}
+
+/**
+ * @brief Appends the brace expansion of a word to the new words.
+ * 
+ * @param word The word, owned: either moved to out or freed.
+ * @param out The new words.
+ * @return false on allocation failure (or if word is NULL).
+ */
+bool	brace_expand(char *word, t_str_vec *out)
+{
+	t_brace	b;
+
+	if (!word)
+		return (false);
+	if (!brace_find(word, &b))
+	{
+		if (str_vec_push(out, word))
+			return (true);
+		free(word);
+		return (false);
+	}
+	if (b.is_range)
+		return (brace_range(word, &b, out));
+	return (brace_list(word, &b, out));
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_brace_range.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:08:52 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 19:08:52 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_brace_range.c
+ * @brief Sequence expressions of the brace expansion (`{x..y[..step]}`).
+ * 
+ * The ends are integers or single letters of the same case. The items
+ * are generated one at a time into the new words, so a large range never
+ * builds a list or a joined string first.
+ */
+
+#include "minishell.h"
+#include "env/env_brace.h"
+
+/**
+ * @brief Returns the index of the first `..` of s, or len if none.
+ */
+static size_t	find_dots(const char *s, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i + 1 < len && !(s[i] == '.' && s[i + 1] == '.'))
+		i++;
+	if (i + 1 < len)
+		return (i);
+	return (len);
+}
+
+/**
+ * @brief Parses one end (or the step) of a range.
+ * 
+ * @param s The text.
+ * @param len Its length.
+ * @param value Set to the number, or to the letter.
+ * @param width Raised to len when the number has a leading zero.
+ * @return 0 if it is neither, 1 for a number, 2 for a letter.
+ */
+static int	parse_end(const char *s, size_t len, long *value, int *width)
+{
+	size_t	i;
+	size_t	j;
+
+	if (len == 1 && ft_isalpha(s[0]))
+	{
+		*value = s[0];
+		return (2);
+	}
+	i = (len > 0 && (s[0] == '-' || s[0] == '+'));
+	if (i >= len || len - i > BRACE_MAX_DIGITS)
+		return (0);
+	*value = 0;
+	j = i;
+	while (j < len && ft_isdigit(s[j]))
+		*value = *value * 10 + s[j++] - '0';
+	if (j < len)
+		return (0);
+	if (s[0] == '-')
+		*value = -*value;
+	if (s[i] == '0' && len - i > 1 && (int)len > *width)
+		*width = len;
+	return (1);
+}
+
+/**
+ * @brief Parses the inside of a brace group as a range.
+ * 
+ * @param s The text between the braces.
+ * @param len Its length.
+ * @param b Filled with the range; its width is 0 on entry.
+ * @return true if the group is a range.
+ */
+bool	brace_range_parse(const char *s, size_t len, t_brace *b)
+{
+	size_t	first;
+	size_t	second;
+	int		kind;
+	int		step_width;
+
+	first = find_dots(s, len);
+	if (first == len)
+		return (false);
+	second = first + 2 + find_dots(s + first + 2, len - first - 2);
+	kind = parse_end(s, first, &b->from, &b->width);
+	if (kind == 0
+		|| parse_end(s + first + 2, second - first - 2, &b->to, &b->width)
+		!= kind)
+		return (false);
+	b->step = 1;
+	if (second < len && parse_end(s + second + 2, len - second - 2,
+			&b->step, &step_width) != 1)
+		return (false);
+	b->is_char = (kind == 2);
+	if (b->step < 0)
+		b->step = -b->step;
+	b->step += (b->step == 0);
+	if (b->from > b->to)
+		b->step = -b->step;
+	return (!b->is_char || (b->from >= 'a') == (b->to >= 'a'));
+}
+
+/**
+ * @brief Builds a word with its first brace group replaced by a text.
+ * 
+ * @param word The word.
+ * @param b The group.
+ * @param mid The text.
+ * @param len The length of the text.
+ * @return The new word, to be freed, or NULL.
+ */
+char	*brace_splice(const char *word, t_brace *b, const char *mid,
+	size_t len)
+{
+	char	*spliced;
+	size_t	tail;
+
+	tail = ft_strlen(word + b->close + 1);
+	spliced = safe_malloc(b->open + len + tail + 1);
+	if (!spliced)
+		return (NULL);
+	ft_memcpy(spliced, word, b->open);
+	ft_memcpy(spliced + b->open, mid, len);
+	ft_memcpy(spliced + b->open + len, word + b->close + 1, tail + 1);
+	return (spliced);
+}
+
+/**
+ * @brief Expands a range, one item after the other.
+ * 
+ * @param word The word, freed.
+ * @param b Its first group, a range.
+ * @param out The new words.
+ * @return false on allocation failure.
+ */
+bool	brace_range(char *word, t_brace *b, t_str_vec *out)
+{
+	char	digits[ARITH_NUM_SIZE];
+	char	item[ARITH_NUM_SIZE * 2];
+	size_t	len;
+	size_t	pad;
+	long	value;
+
+	value = b->from;
+	while ((b->step > 0 && value <= b->to) || (b->step < 0 && value >= b->to))
+	{
+		digits[0] = (char)value;
+		len = 1;
+		if (!b->is_char)
+			len = arith_format(value, digits);
+		pad = 0;
+		if ((int)len < b->width)
+			pad = b->width - len;
+		item[0] = '-';
+		ft_memset(item + (value < 0), '0', pad);
+		ft_memcpy(item + (value < 0) + pad, digits + (value < 0),
+			len - (value < 0));
+		if (!brace_expand(brace_splice(word, b, item, pad + len), out))
+			return (free(word), false);
+		value += b->step;
+	}
+	return (free(word), true);
+}
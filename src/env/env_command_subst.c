@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_command_subst.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:26:03 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:26:03 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file env_command_subst.c
+ * @brief Expansion of command and arithmetic substitutions.
+ * 
+ * `$(list)` is replaced by the output of the list, run in a subshell, with
+ * its trailing newlines removed. `$((expr))` is replaced by the value of
+ * the expression, evaluated in the shell. Both expand the same way
+ * unquoted and inside double quotes, like a variable.
+ */
+
+#include "env/env.h"
+#include "env/env_arith.h"
+#include "executor/cmdsub.h"
+
+bool	free_buffer(t_dynamic_buffer *buffer);
+size_t	cmdsub_len(const char *s);
+size_t	arith_subst_len(const char *s);
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Expands the arithmetic substitution at the current position.
+ * 
+ * Variables and substitutions inside the expression are expanded first.
+ * An invalid expression is reported and marks the line as failed, so that
+ * it is not run.
+ * 
+ * @param ctx Token context, at the `$`.
+ * @param buffer Destination buffer.
+ * @param len Length of the whole `$((expr))`.
+ */
+static void	expand_arith_subst(t_token_context *ctx, t_dynamic_buffer *buffer,
+	size_t len)
+{
+	char	*expr;
+	char	*expanded;
+	char	num[ARITH_NUM_SIZE];
+	int64_t	value;
+
+	expr = ft_strndup(ctx->ptr + 3, len - 5);
+	expanded = NULL;
+	if (expr)
+		expanded = replace_env_variables(expr, ctx->shell);
+	if (expanded && arith_eval(expanded, ctx->shell, &value))
+		append_to_buffer(buffer, num, arith_format(value, num));
+	else
+	{
+		ctx->shell->exit_status = 1;
+		ctx->shell->expand_error = true;
+	}
+	free(expr);
+	free(expanded);
+	ctx->ptr += len;
+}
+
+/**
+ * @brief Expands the command substitution at the current position.
+ * 
+ * A `$(` without its closing parenthesis is copied as is.
+ * 
+ * @param ctx Token context, at the `$`.
+ * @param buffer Destination buffer.
+ */
+void	expand_command_subst(t_token_context *ctx, t_dynamic_buffer *buffer)
+{
+	t_dynamic_buffer	out;
+	size_t				len;
+
+	len = arith_subst_len(ctx->ptr);
+	if (len > 0)
+		return (expand_arith_subst(ctx, buffer, len));
+	len = cmdsub_len(ctx->ptr);
+	if (len == 0)
+	{
+		append_to_buffer(buffer, ctx->ptr, 1);
+		ctx->ptr++;
+		return ;
+	}
+	out.data = NULL;
+	if (capture_command(ctx->ptr + 2, len - 3, ctx->shell, &out))
+		append_to_buffer(buffer, out.data, out.size);
+	free_buffer(&out);
+	ctx->ptr += len;
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_field_split.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:20:03 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 15:20:03 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_field_split.c
+ * @brief Field splitting of an expanded word on IFS.
+ * 
+ * As in POSIX, a sequence of IFS whitespace delimits a field and is
+ * ignored at the start and the end of the word, while each other IFS
+ * character delimits a field, possibly empty. A word that expands to
+ * nothing yields no field.
+ */
+
+#include "minishell.h"
+#include "env/env_fields.h"
+
+void	*safe_malloc(size_t size);
+
+/**
+ * @brief Returns the mark of a byte of the word.
+ * 
+ * @param f The word.
+ * @param i The index of the byte.
+ * @return '0' for the tilde prefix and the bytes past the marks.
+ */
+static char	field_mark(const t_fields *f, size_t i)
+{
+	if (i < f->quoted || i - f->quoted >= f->origin_len)
+		return ('0');
+	return (f->origin[i - f->quoted]);
+}
+
+/**
+ * @brief Tells whether a byte of the word delimits a field.
+ * 
+ * The quotes of the word are followed as the quote removal will see them,
+ * so that the quoted word of a `${VAR:-"a b"}` stays in one field. A quote
+ * that a value brought in ('1') is a plain character.
+ * 
+ * @param f The word, its quote state updated.
+ * @param i The index of the byte.
+ * @return true for an unquoted IFS character from an unquoted expansion.
+ */
+static bool	field_delim(t_fields *f, size_t i)
+{
+	char	c;
+	char	mark;
+
+	c = f->word[i];
+	mark = field_mark(f, i);
+	if (mark != '1' && f->quote && c == f->quote)
+		f->quote = '\0';
+	else if (mark != '1' && !f->quote && (c == '\'' || c == '"'))
+		f->quote = c;
+	if (f->quote || mark == '0')
+		return (false);
+	return (ft_strchr(f->ifs, c) != NULL);
+}
+
+/**
+ * @brief Copies the bytes of a field, escaping the quotes of values.
+ * 
+ * A quote marked '1' is preceded by a backslash, so that the quote
+ * removal keeps it as a literal character.
+ * 
+ * @param f The word.
+ * @param start The index of the first byte of the field.
+ * @param end The index past its last byte.
+ * @return The field, to be freed.
+ */
+static char	*field_text(const t_fields *f, size_t start, size_t end)
+{
+	char	*field;
+	size_t	i;
+	size_t	len;
+
+	len = end - start;
+	i = start;
+	while (i < end)
+	{
+		if (is_quote(f->word[i]) && field_mark(f, i) == '1')
+			len++;
+		i++;
+	}
+	field = safe_malloc(len + 1);
+	len = 0;
+	i = start;
+	while (i < end)
+	{
+		if (is_quote(f->word[i]) && field_mark(f, i) == '1')
+			field[len++] = '\\';
+		field[len++] = f->word[i++];
+	}
+	field[len] = '\0';
+	return (field);
+}
+
+/**
+ * @brief Appends a field to the words of the line.
+ * 
+ * A field that reads as an operator is quoted, so that `|` or `>` coming
+ * from a variable is an argument, not a pipe or a redirection. An empty
+ * field is quoted too, or the parser would drop it.
+ * 
+ * @param f The word.
+ * @param start The index of the first byte of the field.
+ * @param end The index past its last byte.
+ * @return false on allocation failure.
+ */
+static bool	field_push(t_fields *f, size_t start, size_t end)
+{
+	char	*field;
+	char	*quoted;
+
+	if (start == end)
+		field = ft_strdup("''");
+	else
+		field = field_text(f, start, end);
+	if (field && is_operator_token(field))
+	{
+		quoted = glob_quote(field);
+		free(field);
+		field = quoted;
+	}
+	if (!str_vec_push(f->out, field))
+		return (free(field), false);
+	return (true);
+}
+
+/**
+ * @brief Splits a word into fields, appended to f->out.
+ * 
+ * held is set after a field ended by IFS whitespace, which the next
+ * non-whitespace delimiter joins instead of ending an empty field.
+ * 
+ * @param f The word.
+ * @return false on allocation failure.
+ */
+bool	split_fields(t_fields *f)
+{
+	size_t	i;
+	size_t	start;
+	bool	space;
+	bool	held;
+	bool	ok;
+
+	i = 0;
+	start = 0;
+	held = false;
+	ok = true;
+	while (ok && f->word[i])
+	{
+		if (field_delim(f, i))
+		{
+			space = (ft_strchr(IFS_DEFAULT, f->word[i]) != NULL);
+			if (i > start || (!space && !held))
+				ok = field_push(f, start, i);
+			held = space && (i > start || held);
+			start = i + 1;
+		}
+		i++;
+	}
+	if (ok && i > start)
+		ok = field_push(f, start, i);
+	return (ok);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:41:55 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:41:55 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob.c
+ * @brief Brace and pathname expansion of the words of a command line.
+ * 
+ * The braces of a word are expanded first (env_brace.c). Then a word with
+ * an unquoted `*`, `?` or `[` is replaced by the sorted list of the paths
+ * it matches; a word that matches nothing is left as is, as in bash. The
+ * paths are quoted if needed, so that the quote removal done later keeps
+ * them intact.
+ */
+
+#include "minishell.h"
+#include "env/env_glob.h"
+#include "env/env_brace.h"
+
+/**
+ * @brief Returns how a word of the line is globbed.
+ * 
+ * Only the words of a command are brace-expanded, not a redirection
+ * target.
+ * 
+ * @param tokens The words of the line.
+ * @param i The index of the word.
+ * @return The mode.
+ */
+static t_glob_mode	glob_mode(char **tokens, size_t i)
+{
+	const char	*prev;
+	t_brace		brace;
+
+	if ((!pattern_has_glob(tokens[i], ft_strlen(tokens[i]))
+			&& !brace_find(tokens[i], &brace))
+		|| is_operator_token(tokens[i]) || is_arith_command(tokens[i])
+		|| is_procsub_word(tokens[i]))
+		return (GLOB_SKIP);
+	if (i == 0 || !is_redirection_token(tokens[i - 1]))
+		return (GLOB_ALL);
+	prev = skip_fd_prefix(tokens[i - 1]);
+	if (ft_strcmp(prev, "<<") == 0 || ft_strcmp(prev, "<<<") == 0)
+		return (GLOB_SKIP);
+	return (GLOB_ONE);
+}
+
+/**
+ * @brief Appends the expansion of a word to the new words of the line:
+ * its brace expansion, then the matches of each resulting word.
+ * 
+ * @param g The expansion state.
+ * @param out The new words.
+ * @param token The word.
+ * @param mode How the word is globbed.
+ * @return false on allocation failure.
+ */
+static bool	emit_word(t_glob *g, t_str_vec *out, const char *token,
+	t_glob_mode mode)
+{
+	size_t	i;
+	bool	ok;
+
+	g->words.count = 0;
+	if (mode == GLOB_ALL)
+		ok = brace_expand(ft_strdup(token), &g->words);
+	else
+		ok = str_vec_push(&g->words, ft_strdup(token));
+	i = 0;
+	while (i < g->words.count)
+	{
+		if (ok)
+			ok = glob_emit(g, out, g->words.items[i], mode);
+		else
+			free(g->words.items[i]);
+		i++;
+	}
+	return (ok);
+}
+
+/**
+ * @brief Expands the patterns of a command line.
+ * 
+ * @param tokens The words of the line, NULL-terminated.
+ * @return A new NULL-terminated array of new words, to be freed with
+ * free_array, or NULL when no word has a pattern (or on allocation
+ * failure), in which case tokens stand as they are.
+ */
+char	**expand_globs(char **tokens)
+{
+	t_glob		g;
+	t_str_vec	out;
+	size_t		i;
+	bool		ok;
+
+	i = 0;
+	while (tokens[i] && glob_mode(tokens, i) == GLOB_SKIP)
+		i++;
+	if (!tokens[i])
+		return (NULL);
+	ft_memset(&g, 0, sizeof(t_glob));
+	ft_memset(&out, 0, sizeof(t_str_vec));
+	ok = true;
+	i = 0;
+	while (ok && tokens[i])
+	{
+		ok = emit_word(&g, &out, tokens[i], glob_mode(tokens, i));
+		i++;
+	}
+	free_glob(&g);
+	if (ok)
+		return (out.items);
+	free_array(out.items);
+	return (NULL);
+}
+
+/**
+ * @brief Expands the patterns of an owned array of words, replacing it.
+ * 
+ * @param tokens The words, NULL-terminated; replaced and freed when a
+ * pattern is expanded.
+ * @param count The number of words, updated.
+ */
+void	adopt_glob_words(char ***tokens, size_t *count)
+{
+	char	**words;
+
+	words = expand_globs(*tokens);
+	if (!words)
+		return ;
+	free_array(*tokens);
+	*tokens = words;
+	*count = 0;
+	while (words[*count])
+		(*count)++;
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob_cache.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:43:53 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:43:53 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob_cache.c
+ * @brief Directory cache of the pathname expansion.
+ * 
+ * A directory is read with readdir the first time a pattern of the line
+ * needs it, then served from memory. The types that readdir reports are
+ * kept, so only the entries whose type it does not know are stat-ed, and
+ * only when a pattern has to descend into them.
+ */
+
+#include "minishell.h"
+#include "env/env_glob.h"
+#include <dirent.h>
+
+/**
+ * @brief Stores the entries of an open directory, but `.` and `..`.
+ * 
+ * @param dir The cached directory.
+ * @param stream The open directory.
+ */
+static void	read_entries(t_glob_dir *dir, DIR *stream)
+{
+	struct dirent	*entry;
+	char			*name;
+
+	entry = readdir(stream);
+	while (entry)
+	{
+		name = NULL;
+		if (ft_strcmp(entry->d_name, ".") && ft_strcmp(entry->d_name, ".."))
+			name = glob_join(" ", entry->d_name, "");
+		if (name)
+			name[0] = (char)entry->d_type;
+		if (name && !str_vec_push(&dir->entries, name))
+			free(name);
+		entry = readdir(stream);
+	}
+}
+
+/**
+ * @brief Reads a directory.
+ * 
+ * A directory that cannot be opened has no entries.
+ * 
+ * @param path The directory, "" for the current one.
+ * @return The directory, or NULL on allocation failure.
+ */
+static t_glob_dir	*load_dir(const char *path)
+{
+	t_glob_dir		*dir;
+	DIR				*stream;
+
+	dir = safe_malloc(sizeof(t_glob_dir));
+	if (!dir)
+		return (NULL);
+	ft_memset(dir, 0, sizeof(t_glob_dir));
+	dir->path = ft_strdup(path);
+	if (*path == '\0')
+		path = ".";
+	stream = opendir(path);
+	if (!stream)
+		return (dir);
+	read_entries(dir, stream);
+	closedir(stream);
+	return (dir);
+}
+
+/**
+ * @brief Returns a directory from the cache, reading it if needed.
+ * 
+ * @param g The expansion state.
+ * @param path The directory, "" for the current one.
+ * @return The directory, or NULL on allocation failure.
+ */
+t_glob_dir	*glob_dir_get(t_glob *g, const char *path)
+{
+	t_glob_dir	*dir;
+
+	dir = g->cache;
+	while (dir && ft_strcmp(dir->path, path) != 0)
+		dir = dir->next;
+	if (dir)
+		return (dir);
+	dir = load_dir(path);
+	if (!dir)
+		return (NULL);
+	dir->next = g->cache;
+	g->cache = dir;
+	return (dir);
+}
+
+/**
+ * @brief Frees the state of an expansion: the directory cache and the
+ * arrays of the current word.
+ * 
+ * @param g The expansion state.
+ */
+void	free_glob(t_glob *g)
+{
+	t_glob_dir	*dir;
+	t_glob_dir	*next;
+
+	free(g->words.items);
+	free(g->matches.items);
+	dir = g->cache;
+	while (dir)
+	{
+		next = dir->next;
+		free_array(dir->entries.items);
+		free(dir->path);
+		free(dir);
+		dir = next;
+	}
+}
+
+/**
+ * @brief Tells whether a cached entry is a directory.
+ * 
+ * @param entry The entry, its type byte first.
+ * @param path The path of the entry, stat-ed only if its type is unknown
+ * or a symbolic link.
+ * @return true for a directory, or a link to one.
+ */
+bool	glob_entry_is_dir(const char *entry, const char *path)
+{
+	struct stat	st;
+
+	if (entry[0] == DT_DIR)
+		return (true);
+	if (entry[0] != DT_UNKNOWN && entry[0] != DT_LNK)
+		return (false);
+	return (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:48:35 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:48:35 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob_utils.c
+ * @brief String helpers of the pathname expansion.
+ */
+
+#include "minishell.h"
+#include "env/env_glob.h"
+
+/**
+ * @brief Orders strings for qsort, byte by byte.
+ */
+int	glob_compare(const void *a, const void *b)
+{
+	return (ft_strcmp(*(char *const *)a, *(char *const *)b));
+}
+
+/**
+ * @brief Appends a string to a vector, keeping it NULL-terminated.
+ * 
+ * @param vec The vector.
+ * @param s The string, owned by the vector from now on.
+ * @return false on allocation failure or if s is NULL.
+ */
+bool	str_vec_push(t_str_vec *vec, char *s)
+{
+	char	**items;
+	size_t	capacity;
+
+	if (!s)
+		return (false);
+	if (vec->count + 1 >= vec->capacity)
+	{
+		capacity = vec->capacity * 2 + 8;
+		items = ft_realloc(vec->items, vec->capacity * sizeof(char *),
+				capacity * sizeof(char *));
+		if (!items)
+			return (false);
+		vec->items = items;
+		vec->capacity = capacity;
+	}
+	vec->items[vec->count++] = s;
+	vec->items[vec->count] = NULL;
+	return (true);
+}
+
+/**
+ * @brief Quotes a file name that replaces a pattern, so that the quote
+ * removal and the parser that run after the expansion leave it as is.
+ * 
+ * @param name The file name.
+ * @return The word, to be freed.
+ */
+char	*glob_quote(const char *name)
+{
+	char	*word;
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (name[i] && !ft_strchr(GLOB_QUOTE_CHARS, name[i]))
+		i++;
+	if (!name[i])
+		return (ft_strdup(name));
+	word = safe_malloc(ft_strlen(name) * 5 + 3);
+	if (!word)
+		return (NULL);
+	word[0] = '\'';
+	ft_memcpy(word + 1, name, i);
+	j = i + 1;
+	while (name[i])
+	{
+		if (name[i] == '\'')
+			ft_memcpy(word + j, "'\"'\"'", 5);
+		else
+			word[j] = name[i];
+		j += 1 + 4 * (name[i++] == '\'');
+	}
+	ft_memcpy(word + j, "'", 2);
+	return (word);
+}
+
+/**
+ * @brief Tells whether a pattern has an unescaped `*`, `?` or `[`.
+ * 
+ * @param pattern The pattern, as made by pattern_from_word.
+ * @param len The number of characters to look at.
+ * @return true if it needs matching against directory entries.
+ */
+bool	pattern_has_glob(const char *pattern, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (pattern[i] == '\\' && i + 1 < len)
+			i++;
+		else if (pattern[i] == '*' || pattern[i] == '?' || pattern[i] == '[')
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Concatenates three strings.
+ * 
+ * @return The result, to be freed, or NULL on allocation failure.
+ */
+char	*glob_join(const char *a, const char *b, const char *c)
+{
+	char	*s;
+	size_t	la;
+	size_t	lb;
+	size_t	lc;
+
+	la = ft_strlen(a);
+	lb = ft_strlen(b);
+	lc = ft_strlen(c);
+	s = safe_malloc(la + lb + lc + 1);
+	if (!s)
+		return (NULL);
+	ft_memcpy(s, a, la);
+	ft_memcpy(s + la, b, lb);
+	ft_memcpy(s + la + lb, c, lc);
+	s[la + lb + lc] = '\0';
+	return (s);
+}
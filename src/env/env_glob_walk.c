@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob_walk.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:40:12 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:40:12 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob_walk.c
+ * @brief Matching of a pattern against the file system.
+ * 
+ * The pattern is taken one component at a time. A component without
+ * `*`, `?` or `[` is appended to the path as is, without reading its
+ * directory; the others are matched against the cached entries of the
+ * directory, and only the matching entries are followed. Entries starting
+ * with a `.` only match a component that starts with one.
+ */
+
+#include "minishell.h"
+#include "env/env_glob.h"
+
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Removes the backslashes of a literal component, in place.
+ * 
+ * @param s The component.
+ */
+static void	unescape(char *s)
+{
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	j = 0;
+	while (s[i])
+	{
+		if (s[i] == '\\' && s[i + 1])
+			i++;
+		s[j++] = s[i++];
+	}
+	s[j] = '\0';
+}
+
+/**
+ * @brief Follows a component without pattern characters.
+ * 
+ * @param g The expansion state.
+ * @param path The path so far, "" or ending with a `/`.
+ * @param comp The component.
+ * @param rest The components after it, NULL for the last one.
+ * @return false on allocation failure.
+ */
+static bool	walk_literal(t_glob *g, const char *path, char *comp,
+	const char *rest)
+{
+	char	*next;
+	bool	ok;
+
+	unescape(comp);
+	if (rest)
+		next = glob_join(path, comp, "/");
+	else
+		next = glob_join(path, comp, "");
+	if (!next)
+		return (false);
+	if (rest)
+		ok = glob_walk(g, next, rest);
+	else if (access(next, F_OK) == 0)
+		return (str_vec_push(&g->matches, next));
+	else
+		ok = true;
+	free(next);
+	return (ok);
+}
+
+/**
+ * @brief Follows a directory entry matching a component that is not the
+ * last one. Entries that are not directories are dropped there.
+ * 
+ * @param g The expansion state.
+ * @param path The path so far, "" or ending with a `/`.
+ * @param entry The cached entry, its type byte first.
+ * @param rest The components after it.
+ * @return false on allocation failure.
+ */
+static bool	descend(t_glob *g, const char *path, const char *entry,
+	const char *rest)
+{
+	char	*next;
+	bool	ok;
+
+	next = glob_join(path, entry + 1, "/");
+	if (!next)
+		return (false);
+	ok = true;
+	if (glob_entry_is_dir(entry, next))
+		ok = glob_walk(g, next, rest);
+	free(next);
+	return (ok);
+}
+
+/**
+ * @brief Follows a component with pattern characters.
+ * 
+ * @param g The expansion state.
+ * @param path The path so far, "" or ending with a `/`.
+ * @param comp The component.
+ * @param rest The components after it, NULL for the last one.
+ * @return false on allocation failure.
+ */
+static bool	walk_dir(t_glob *g, const char *path, const char *comp,
+	const char *rest)
+{
+	t_glob_dir	*dir;
+	char		*next;
+	size_t		i;
+	bool		ok;
+
+	dir = glob_dir_get(g, path);
+	ok = (dir != NULL);
+	i = 0;
+	while (ok && i < dir->entries.count)
+	{
+		next = dir->entries.items[i++] + 1;
+		if ((*next == '.' && *comp != '.')
+			|| !glob_match(comp, next, ft_strlen(next)))
+			continue ;
+		if (!rest)
+			ok = str_vec_push(&g->matches, glob_join(path, next, ""));
+		else
+			ok = descend(g, path, dir->entries.items[i - 1], rest);
+	}
+	return (ok);
+}
+
+/**
+ * @brief Adds the paths matching a pattern to g->matches.
+ * 
+ * @param g The expansion state.
+ * @param path The path so far, "" or ending with a `/`.
+ * @param pattern The components left, without leading `/`.
+ * @return false on allocation failure.
+ */
+bool	glob_walk(t_glob *g, const char *path, const char *pattern)
+{
+	size_t		len;
+	const char	*rest;
+	char		*comp;
+	bool		ok;
+
+	if (*pattern == '\0' && access(path, F_OK) != 0)
+		return (true);
+	if (*pattern == '\0')
+		return (str_vec_push(&g->matches, ft_strdup(path)));
+	rest = ft_strchr(pattern, '/');
+	len = ft_strlen(pattern);
+	if (rest)
+		len = rest - pattern;
+	while (rest && *rest == '/')
+		rest++;
+	comp = ft_strndup(pattern, len);
+	if (!comp)
+		return (false);
+	if (pattern_has_glob(comp, len))
+		ok = walk_dir(g, path, comp, rest);
+	else
+		ok = walk_literal(g, path, comp, rest);
+	free(comp);
+	return (ok);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_glob_word.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 19:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_glob_word.c
+ * @brief Pathname expansion of a single word.
+ */
+
+#include "minishell.h"
+#include "env/env_glob.h"
+
+/**
+ * @brief Collects the sorted matches of a word in g->matches.
+ * 
+ * @param g The expansion state.
+ * @param token The word.
+ * @return The number of matches.
+ */
+static size_t	glob_word(t_glob *g, const char *token)
+{
+	char		*pattern;
+	const char	*start;
+
+	g->matches.count = 0;
+	pattern = pattern_from_word(token);
+	if (!pattern)
+		return (0);
+	if (pattern_has_glob(pattern, ft_strlen(pattern)))
+	{
+		start = pattern;
+		while (*start == '/')
+			start++;
+		if (start != pattern)
+			glob_walk(g, "/", start);
+		else
+			glob_walk(g, "", start);
+		qsort(g->matches.items, g->matches.count, sizeof(char *),
+			glob_compare);
+	}
+	free(pattern);
+	return (g->matches.count);
+}
+
+/**
+ * @brief Appends a word, or the paths it matches, to the new words.
+ * 
+ * @param g The expansion state.
+ * @param out The new words.
+ * @param word The word, owned: either moved to out or freed.
+ * @param mode How the word is globbed.
+ * @return false on allocation failure.
+ */
+bool	glob_emit(t_glob *g, t_str_vec *out, char *word, t_glob_mode mode)
+{
+	size_t	count;
+	size_t	i;
+	bool	keep;
+	bool	ok;
+
+	count = 0;
+	if (mode != GLOB_SKIP && pattern_has_glob(word, ft_strlen(word)))
+		count = glob_word(g, word);
+	keep = (count == 0 || (mode == GLOB_ONE && count != 1));
+	ok = true;
+	if (keep)
+		ok = str_vec_push(out, word);
+	if (!ok || !keep)
+		free(word);
+	i = 0;
+	while (i < count)
+	{
+		if (ok && !keep)
+			ok = str_vec_push(out, glob_quote(g->matches.items[i]));
+		free(g->matches.items[i]);
+		i++;
+	}
+	g->matches.count = 0;
+	return (ok);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_intern.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:47:30 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 01:47:30 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_intern.c
+ * @brief Interning table of the names of variables.
+ * 
+ * Each name has a single shared string, held by every node of that
+ * variable across the environment and its snapshots. Looking a variable
+ * up first finds its name in the table: a name that was never set misses
+ * without walking the list, and the nodes are then matched by address.
+ * A name leaves the table with its last holder.
+ */
+
+#include "env/env.h"
+
+/**
+ * @brief Returns the buckets of the interning table singleton.
+ * 
+ * @return The ENV_INTERN_BUCKETS chains of interned names.
+ */
+static t_env_str	**intern_buckets(void)
+{
+	static t_env_str	*buckets[ENV_INTERN_BUCKETS];
+
+	return (buckets);
+}
+
+/**
+ * @brief Hashes a name (FNV-1a) to its bucket.
+ * 
+ * @param name The name.
+ * @return The index of its bucket.
+ */
+static size_t	intern_hash(const char *name)
+{
+	size_t	hash;
+
+	hash = 2166136261u;
+	while (*name)
+	{
+		hash ^= (unsigned char)*name++;
+		hash *= 16777619u;
+	}
+	return (hash % ENV_INTERN_BUCKETS);
+}
+
+/**
+ * @brief Finds the interned string of a name.
+ * 
+ * @param name The name.
+ * @return The interned string, not held for the caller, or NULL if no
+ * variable has this name.
+ */
+char	*env_intern_find(const char *name)
+{
+	t_env_str	*str;
+
+	if (!name)
+		return (NULL);
+	str = intern_buckets()[intern_hash(name)];
+	while (str && ft_strcmp((char *)(str + 1), name) != 0)
+		str = str->next;
+	if (!str)
+		return (NULL);
+	return ((char *)(str + 1));
+}
+
+/**
+ * @brief Interns a name.
+ * 
+ * @param name The name.
+ * @return Its interned string, held once more by the caller (release it
+ * with env_str_release), or NULL on allocation failure.
+ */
+char	*env_intern(const char *name)
+{
+	t_env_str	**bucket;
+	char		*key;
+
+	key = env_intern_find(name);
+	if (key)
+		return (env_str_ref(key));
+	key = env_str_new(name);
+	if (!key)
+		return (NULL);
+	bucket = &intern_buckets()[intern_hash(name)];
+	((t_env_str *)key - 1)->interned = true;
+	((t_env_str *)key - 1)->next = *bucket;
+	*bucket = (t_env_str *)key - 1;
+	return (key);
+}
+
+/**
+ * @brief Unlinks a name from the table, when its last holder drops it.
+ * 
+ * @param name The interned string.
+ */
+void	env_intern_remove(char *name)
+{
+	t_env_str	**link;
+
+	link = &intern_buckets()[intern_hash(name)];
+	while (*link && *link != (t_env_str *)name - 1)
+		link = &(*link)->next;
+	if (*link)
+		*link = (*link)->next;
+}
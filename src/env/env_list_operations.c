@@ -38,19 +38,21 @@ bool	allocate_value(const char *value_start, char **value)
 	return (true);
 }
 
-bool	update_if_duplicate(t_env *head, const char *key,
-			const char *value, t_env *new_node)
+/**
+ * @brief Sets the value of a variable if the list already has it.
+ *
+ * @param head The head of the environment list.
+ * @param key The name of the variable.
+ * @param value The new value, copied. Can be NULL.
+ * @return true if the variable was found and updated.
+ */
+bool	update_if_duplicate(t_env *head, const char *key, const char *value)
 {
-	while (head)
+	head = env_own(head, key);
+	if (head && ft_strcmp(head->key, key) == 0)
 	{
-		if (ft_strcmp(head->key, key) == 0)
-		{
-			safe_free((void **)&head->value);
-			head->value = ft_strdup(value);
-			free_env_node(new_node);
-			return (true);
-		}
-		head = head->next;
+		env_str_set(&head->value, env_str_new(value));
+		return (true);
 	}
 	return (false);
 }
@@ -58,6 +60,9 @@ bool	update_if_duplicate(t_env *head, const char *key,
 /**
 * @brief Frees the memory allocated for the environment list.
 *
+* Only the nodes that no other list (a snapshot, or the environment a
+* snapshot was taken from) still points to are freed.
+*
 * @param head The head of the environment list.
 */
 void	free_env_list(t_env *head)
@@ -66,16 +71,20 @@ void	free_env_list(t_env *head)
 
 	while (head != NULL)
 	{
+		head->refs--;
+		if (head->refs > 0)
+			return ;
 		tmp = head->next;
 		free_env_node(head);
 		head = tmp;
 	}
-	safe_free((void **)&head);
 }
 
 void	append_to_list(t_env *head, t_env *new_node)
 {
-	while (head->next)
-		head = head->next;
-	head->next = new_node;
+	head = env_own(head, NULL);
+	if (head)
+		head->next = new_node;
+	else
+		free_env_node(new_node);
 }
@@ -24,15 +24,16 @@
  * a pointer to the next node in the list.
  */
 
-bool	update_if_duplicate(t_env *head, const char *key, const char *value,
-			t_env *new_node);
+bool	update_if_duplicate(t_env *head, const char *key, const char *value);
 void	append_to_list(t_env *head, t_env *new_node);
 
 /**
  * @brief Finds an environment variable node by its key.
  * 
  * This function searches through the linked list of environment variables
- * to find the first node that matches the specified key.
+ * to find the first node that matches the specified key. The key is
+ * looked up in the interning table first, and the nodes are compared by
+ * the address of their interned key.
  * 
  * @param env The head of the environment list to search in.
  * @param key The key to search for. Must not be NULL.
@@ -40,11 +41,16 @@ void	append_to_list(t_env *head, t_env *new_node);
  */
 t_env	*find_env_variable(t_env *env, const char *key)
 {
+	char	*name;
+
 	if (!key || !env)
 		return (NULL);
+	name = env_intern_find(key);
+	if (!name)
+		return (NULL);
 	while (env)
 	{
-		if (env->key && ft_strcmp(env->key, key) == 0)
+		if (env->key == name)
 			return (env);
 		env = env->next;
 	}
@@ -86,11 +92,12 @@ t_env	*env_create_empty_node(t_env *env, const char *key)
 {
 	t_env	*new_node;
 
+	env = env_own(env, NULL);
+	if (!env)
+		return (NULL);
 	new_node = initialize_env_node(key, NULL);
 	if (!new_node)
 		return (NULL);
-	while (env->next)
-		env = env->next;
 	env->next = new_node;
 	return (new_node);
 }
@@ -107,29 +114,33 @@ t_env	*env_create_empty_node(t_env *env, const char *key)
  * @return t_env* The new head of the environment list.
  * 
  * @note If the key is not found, the function returns the original list.
+ * When the head is removed and the next node is shared with a snapshot,
+ * the new head is a copy of it, as the head of a list is never shared.
  */
 t_env	*env_remove_node(t_env *env, const char *key)
 {
-	t_env	*current;
+	t_env	*target;
 	t_env	*prev;
 
-	current = env;
-	prev = NULL;
-	while (current)
+	target = env_own(env, key);
+	if (!target || ft_strcmp(target->key, key) != 0)
+		return (env);
+	prev = env;
+	while (prev != target && prev->next != target)
+		prev = prev->next;
+	if (prev != target)
 	{
-		if (ft_strcmp(current->key, key) == 0)
-		{
-			if (prev)
-				prev->next = current->next;
-			else
-				env = current->next;
-			free_env_node(current);
-			return (env);
-		}
-		prev = current;
-		current = current->next;
+		prev->next = target->next;
+		free_env_node(target);
+		return (env);
 	}
-	return (env);
+	prev = env->next;
+	free_env_node(env);
+	if (!prev || prev->refs == 1)
+		return (prev);
+	target = env_snapshot(prev);
+	free_env_list(prev);
+	return (target);
 }
 
 /**
@@ -137,7 +148,8 @@ t_env	*env_remove_node(t_env *env, const char *key)
  * 
  * This function creates a new node with the given key and value and
  * appends it to the end of the linked list. If the list is empty,
- * the new node becomes the head.
+ * the new node becomes the head. A variable already in the list gets the
+ * new value instead, without creating a node.
  * 
  * @param head A pointer to the head of the environment list.
  * @param key The key of the new node.
@@ -149,6 +161,8 @@ void	env_append_node(t_env **head, const char *key, const char *value)
 {
 	t_env	*new_node;
 
+	if (*head && update_if_duplicate(*head, key, value))
+		return ;
 	new_node = initialize_env_node(key, value);
 	if (!new_node)
 	{
@@ -156,10 +170,7 @@ void	env_append_node(t_env **head, const char *key, const char *value)
 		return ;
 	}
 	if (!*head)
-	{
 		*head = new_node;
-		return ;
-	}
-	if (!update_if_duplicate(*head, key, value, new_node))
+	else
 		append_to_list(*head, new_node);
 }
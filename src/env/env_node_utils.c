@@ -19,6 +19,9 @@
  * The environment list is a linked list that stores environment variables
  * as key-value pairs. Each node in the list contains a key, a value, and
  * a pointer to the next node in the list.
+ * 
+ * The key and the value of a node are shared strings (see env_string.c),
+ * the key being interned: nodes hold them rather than own copies.
  */
 
 #include "env/env.h"
@@ -29,7 +32,8 @@ void	*safe_malloc(size_t size);
  * @brief Frees a single environment node.
  * 
  * This function releases all dynamically allocated memory for a given 
- * environment node, including its key and value, and the node itself.
+ * environment node, including its holds on its key and value, and the
+ * node itself.
  * 
  * @param node The environment node to free. Can safely be NULL.
  * 
@@ -42,10 +46,8 @@ void	free_env_node(t_env *node)
 		if (node->is_freed)
 			return ;
 		node->is_freed = true;
-		if (node->key)
-			safe_free((void **)&node->key);
-		if (node->value)
-			safe_free((void **)&node->value);
+		env_str_release(node->key);
+		env_str_release(node->value);
 		safe_free((void **)&node);
 	}
 }
@@ -57,12 +59,12 @@ t_env	*set_env_node(const char *key, const char *value)
 	new_node = (t_env *)safe_malloc(sizeof(t_env));
 	if (!new_node)
 		return (NULL);
-	new_node->key = ft_strdup(key);
-	if (value)
-		new_node->value = ft_strdup(value);
-	else
-		new_node->value = NULL;
+	new_node->key = env_intern(key);
+	new_node->value = env_str_new(value);
 	new_node->next = NULL;
+	new_node->refs = 1;
+	new_node->flags = ENV_EXPORTED;
+	new_node->is_freed = false;
 	if (!new_node->key || (value && !new_node->value))
 	{
 		ft_error_msg("initialize_env_node",
@@ -70,16 +72,16 @@ t_env	*set_env_node(const char *key, const char *value)
 		free_env_node(new_node);
 		return (NULL);
 	}
-	new_node->is_freed = false;
 	return (new_node);
 }
 
 /**
  * @brief Initializes a new node with a given key and value.
  * 
- * This function creates a new environment node and allocates memory for the
- * key and value. If memory allocation fails at any point, it cleans up
- * and returns NULL.
+ * This function creates a new environment node, interns the key and
+ * copies the value into a shared string. The variable is exported, as
+ * those of the environment the shell got; env_assign sets other flags. If memory allocation fails at
+ * any point, it cleans up and returns NULL.
  * 
  * @param key The key for the environment variable.
  * @param value The value for the environment variable. Can be NULL.
@@ -107,3 +109,28 @@ t_env	*initialize_env_node(const char *key, const char *value)
 	}
 	return (new_node);
 }
+
+/**
+ * @brief Creates a node holding the same key and value as another one.
+ * 
+ * Nothing is copied but the node: the strings are shared and the flags
+ * are the same.
+ * 
+ * @param node The node to copy.
+ * @return The new node, not linked, or NULL on allocation failure.
+ */
+t_env	*env_node_share(const t_env *node)
+{
+	t_env	*new_node;
+
+	new_node = (t_env *)safe_malloc(sizeof(t_env));
+	if (!new_node)
+		return (NULL);
+	new_node->key = env_str_ref(node->key);
+	new_node->value = env_str_ref(node->value);
+	new_node->next = NULL;
+	new_node->refs = 1;
+	new_node->flags = node->flags;
+	new_node->is_freed = false;
+	return (new_node);
+}
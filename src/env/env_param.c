@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:28:34 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:28:34 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_param.c
+ * @brief Parsing of braced parameter expansions.
+ * 
+ * `${name}` is `$name` with explicit bounds. The operators work on the
+ * value in the shell, without forking: `${#name}` is its length,
+ * `${name:-word}`, `:=`, `:?` and `:+` use, assign, report or replace a
+ * default (without the colon, only an unset parameter counts as missing),
+ * `${name:offset:length}` is a substring and `#`, `##`, `%`, `%%` remove
+ * a prefix or suffix matching a pattern.
+ */
+
+#include "minishell.h"
+#include "env/env_param.h"
+
+char	*ft_strndup(const char *s, size_t n);
+size_t	param_subst_len(const char *s);
+
+/**
+ * @brief Returns the length of the parameter name at s.
+ * 
+ * @param s The text after `${` (and after the `#` of a length).
+ * @return The length of a variable name, 1 for a special parameter, 0
+ * otherwise.
+ */
+static size_t	param_name_len(const char *s)
+{
+	if (is_special_param(*s))
+		return (1);
+	return (arith_name_len(s));
+}
+
+/**
+ * @brief Parses the name and operator of a `${...}` and looks its value up.
+ * 
+ * @param p Receives the parsed expansion.
+ * @param body The text between the braces.
+ * @param shell The shell.
+ * @return false if the expansion is invalid.
+ */
+static bool	parse_param(t_param *p, const char *body, t_shell *shell)
+{
+	size_t	len;
+
+	len = param_name_len(body);
+	p->name = NULL;
+	if (len > 0)
+		p->name = ft_strndup(body, len);
+	if (!p->name)
+		return (false);
+	param_lookup(p, shell);
+	body += len;
+	p->colon = (body[0] == ':' && body[1] && ft_strchr("-=?+", body[1]));
+	p->longest = ((body[0] == '#' || body[0] == '%') && body[1] == body[0]);
+	body += p->colon + p->longest;
+	p->op = *body;
+	p->word = body + (*body != '\0');
+	return (p->op == '\0' || ft_strchr("-=?+:#%", p->op));
+}
+
+/**
+ * @brief Expands a parsed `${...}`.
+ * 
+ * @param ctx Token context.
+ * @param buffer Destination buffer.
+ * @param p The parsed expansion.
+ * @param length true for `${#name}`.
+ * @return false if the expansion is invalid.
+ */
+static bool	apply_param(t_token_context *ctx, t_dynamic_buffer *buffer,
+	t_param *p, bool length)
+{
+	char	num[ARITH_NUM_SIZE];
+	size_t	len;
+
+	if (length && p->op != '\0')
+		return (false);
+	len = 0;
+	if (p->value)
+		len = ft_strlen(p->value);
+	if (length)
+		append_to_buffer(buffer, num, arith_format(len, num));
+	else if (p->op == '\0')
+		append_to_buffer(buffer, p->value, len);
+	else if (ft_strchr("-=?+", p->op))
+		param_default(ctx, buffer, p);
+	else if (p->op == ':')
+		param_substring(ctx, buffer, p);
+	else
+		param_trim(ctx, buffer, p);
+	return (true);
+}
+
+/**
+ * @brief Reports an invalid `${...}`.
+ * 
+ * @param ctx Token context, after the expansion.
+ * @param start The `$` of the expansion.
+ */
+static void	bad_substitution(t_token_context *ctx, const char *start)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	write(STDERR_FILENO, start, ctx->ptr - start);
+	ft_putstr_fd(": bad substitution\n", STDERR_FILENO);
+	param_failed(ctx);
+}
+
+/**
+ * @brief Expands the `${...}` at the current position.
+ * 
+ * A `${` without its closing brace is copied as is.
+ * 
+ * @param ctx Token context, at the `$`.
+ * @param buffer Destination buffer.
+ */
+void	expand_param_subst(t_token_context *ctx, t_dynamic_buffer *buffer)
+{
+	const char	*start;
+	char		*body;
+	t_param		p;
+	bool		length;
+	bool		ok;
+
+	start = ctx->ptr;
+	ctx->ptr += param_subst_len(start);
+	if (ctx->ptr == start)
+	{
+		append_to_buffer(buffer, ctx->ptr, 1);
+		ctx->ptr++;
+		return ;
+	}
+	body = ft_strndup(start + 2, ctx->ptr - start - 3);
+	if (!body)
+		return ;
+	length = (body[0] == '#' && body[1] != '\0');
+	ok = parse_param(&p, body + length, ctx->shell)
+		&& apply_param(ctx, buffer, &p, length);
+	if (!ok)
+		bad_substitution(ctx, start);
+	free(p.name);
+	free(body);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_ops.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:29:55 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:29:55 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_param_ops.c
+ * @brief Default values of braced parameter expansions.
+ */
+
+#include "minishell.h"
+#include "env/env_param.h"
+
+void	quit_shell(t_shell *shell);
+
+/**
+ * @brief Marks the current line as failed: its expansion was reported
+ * as an error, so it is not run.
+ * 
+ * @param ctx Token context.
+ */
+void	param_failed(t_token_context *ctx)
+{
+	ctx->shell->exit_status = 1;
+	ctx->shell->expand_error = true;
+}
+
+/**
+ * @brief Looks the value of a parameter up.
+ * 
+ * @param p The parsed expansion; its value is set, NULL if unset.
+ * @param shell The shell.
+ */
+void	param_lookup(t_param *p, t_shell *shell)
+{
+	if (is_special_param(*p->name))
+	{
+		p->value = special_param(shell, *p->name, p->status);
+		return ;
+	}
+	p->value = get_env_value(p->name, shell->env);
+}
+
+/**
+ * @brief Expands the word of an operator, like the rest of the token.
+ * 
+ * @param ctx Token context.
+ * @param word The word.
+ * @return The expanded word, quotes kept, to be freed.
+ */
+char	*param_word(t_token_context *ctx, const char *word)
+{
+	return (replace_env_variables(word, ctx->shell));
+}
+
+/**
+ * @brief Reports `${name:?word}` for a missing parameter.
+ * 
+ * As in POSIX, a non-interactive shell then exits with status 1. The list
+ * of a substitution is expanded by the shell itself, before its subshell
+ * is forked, so an error there only fails the substitution.
+ * 
+ * @param ctx Token context.
+ * @param p The parsed expansion.
+ * @param word The expanded word, with its quotes.
+ */
+static void	param_error(t_token_context *ctx, t_param *p, char *word)
+{
+	char	*message;
+
+	message = handle_quotes(word);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(p->name, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	if (message && *message)
+		ft_putstr_fd(message, STDERR_FILENO);
+	else if (p->colon)
+		ft_putstr_fd("parameter null or not set", STDERR_FILENO);
+	else
+		ft_putstr_fd("parameter not set", STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	free(message);
+	param_failed(ctx);
+	if (!ctx->shell->interactive && ctx->shell->subst_depth == 0)
+		quit_shell(ctx->shell);
+}
+
+/**
+ * @brief Expands `${name-word}`, `${name=word}`, `${name?word}` and
+ * `${name+word}`, and their `:` forms.
+ * 
+ * The word is only expanded when it is used. `=` assigns it, without its
+ * quotes, before expanding to it.
+ * 
+ * @param ctx Token context.
+ * @param buffer Destination buffer.
+ * @param p The parsed expansion.
+ */
+void	param_default(t_token_context *ctx, t_dynamic_buffer *buffer,
+	t_param *p)
+{
+	bool	missing;
+	char	*word;
+	char	*value;
+
+	missing = (!p->value || (p->colon && *p->value == '\0'));
+	if (missing == (p->op == '+'))
+	{
+		if (p->op != '+')
+			append_to_buffer(buffer, p->value, ft_strlen(p->value));
+		return ;
+	}
+	word = param_operand(ctx, buffer, p);
+	if (!word)
+		return ;
+	if (p->op == '?')
+		param_error(ctx, p, word);
+	value = NULL;
+	if (p->op == '=' && *p->name != '?')
+		value = handle_quotes(word);
+	if (value)
+		env_assign(&ctx->shell->env, p->name, value, 0);
+	free(value);
+	free(word);
+}
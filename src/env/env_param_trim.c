@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_trim.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:24:32 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:24:32 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_param_trim.c
+ * @brief Substrings and prefix or suffix removal of braced parameter
+ * expansions.
+ */
+
+#include "minishell.h"
+#include "env/env_param.h"
+#include "utils/glob_match.h"
+
+/**
+ * @brief Computes the bounds of `${name:offset}` or
+ * `${name:offset:length}`.
+ * 
+ * Both are arithmetic expressions. A negative offset counts from the end,
+ * a negative length leaves that many characters out at the end, and an
+ * offset out of the value gives an empty string.
+ * 
+ * @param spec The expanded text after the `:`, modified.
+ * @param shell The shell.
+ * @param len The length of the value.
+ * @param bounds Receives the start and end of the substring.
+ * @return false on an invalid expression, already reported.
+ */
+static bool	substring_bounds(char *spec, t_shell *shell, int64_t len,
+	int64_t bounds[2])
+{
+	char	*colon;
+	int64_t	count;
+
+	colon = ft_strchr(spec, ':');
+	if (colon)
+		*colon = '\0';
+	if (!arith_eval(spec, shell, &bounds[0])
+		|| (colon && !arith_eval(colon + 1, shell, &count)))
+		return (false);
+	if (bounds[0] < 0)
+		bounds[0] += len;
+	bounds[1] = len;
+	if (bounds[0] < 0 || bounds[0] > len)
+		bounds[0] = len;
+	else if (colon && count < 0)
+		bounds[1] = len + count;
+	else if (colon && count < len - bounds[0])
+		bounds[1] = bounds[0] + count;
+	if (bounds[1] >= bounds[0])
+		return (true);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(colon + 1, STDERR_FILENO);
+	ft_putstr_fd(": substring expression < 0\n", STDERR_FILENO);
+	return (false);
+}
+
+/**
+ * @brief Expands `${name:offset}` and `${name:offset:length}`.
+ * 
+ * @param ctx Token context.
+ * @param buffer Destination buffer.
+ * @param p The parsed expansion.
+ */
+void	param_substring(t_token_context *ctx, t_dynamic_buffer *buffer,
+	t_param *p)
+{
+	char	*spec;
+	int64_t	bounds[2];
+	int64_t	len;
+
+	spec = param_word(ctx, p->word);
+	if (!spec)
+		return ;
+	param_lookup(p, ctx->shell);
+	len = 0;
+	if (p->value)
+		len = ft_strlen(p->value);
+	if (!substring_bounds(spec, ctx->shell, len, bounds))
+		param_failed(ctx);
+	else if (p->value)
+		append_to_buffer(buffer, p->value + bounds[0], bounds[1] - bounds[0]);
+	free(spec);
+}
+
+/**
+ * @brief Returns the length of the prefix or suffix to remove.
+ * 
+ * The shortest match is searched from the shortest cut, the longest one
+ * from the whole value.
+ * 
+ * @param p The parsed expansion.
+ * @param pattern The pattern to remove.
+ * @param len The length of the value.
+ * @return The length of the match, 0 if the pattern does not match.
+ */
+static size_t	trim_len(t_param *p, const char *pattern, size_t len)
+{
+	size_t	cut;
+	size_t	i;
+
+	i = 0;
+	while (i <= len)
+	{
+		cut = i;
+		if (p->longest)
+			cut = len - i;
+		if (p->op == '#' && glob_match(pattern, p->value, cut))
+			return (cut);
+		if (p->op == '%' && glob_match(pattern, p->value + len - cut, cut))
+			return (cut);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Expands `${name#pattern}`, `##`, `%` and `%%`.
+ * 
+ * The pattern is expanded first; its quoted characters match literally.
+ * The value is looked up after that, since the expansion may assign it.
+ * 
+ * @param ctx Token context.
+ * @param buffer Destination buffer.
+ * @param p The parsed expansion.
+ */
+void	param_trim(t_token_context *ctx, t_dynamic_buffer *buffer, t_param *p)
+{
+	char	*word;
+	char	*pattern;
+	size_t	len;
+	size_t	cut;
+
+	word = param_word(ctx, p->word);
+	pattern = NULL;
+	if (word)
+		pattern = pattern_from_word(word);
+	free(word);
+	param_lookup(p, ctx->shell);
+	if (!pattern || !p->value)
+	{
+		free(pattern);
+		return ;
+	}
+	len = ft_strlen(p->value);
+	cut = trim_len(p, pattern, len);
+	if (p->op == '#')
+		append_to_buffer(buffer, p->value + cut, len - cut);
+	else
+		append_to_buffer(buffer, p->value, len - cut);
+	free(pattern);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_param_word.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:12:41 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 10:12:41 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_param_word.c
+ * @brief Operand word of `${name:-word}` and its sibling forms.
+ */
+
+#include "minishell.h"
+#include "env/env_param.h"
+
+void	*ft_memset(void *ptr, int value, size_t num);
+
+/**
+ * @brief Appends the marks of an expanded operand to the marks of the word.
+ * 
+ * The bytes of the operand's own text, marked '0' by its expansion, are
+ * split like the rest of the `${...}` but keep their quotes as shell
+ * quotes: they are marked '2'. The values the operand expands keep their
+ * marks.
+ * 
+ * @param mask The marks of the word, padded up to the operand.
+ * @param marks The marks of the operand.
+ * @param size The size of the word before the operand.
+ */
+static void	append_operand_marks(t_dynamic_buffer *mask,
+	const t_dynamic_buffer *marks, size_t size)
+{
+	size_t	i;
+	char	mark;
+
+	while (mask->size < size)
+		append_to_buffer(mask, "1", 1);
+	i = 0;
+	while (i < marks->size)
+	{
+		mark = marks->data[i];
+		if (mark == '0')
+			mark = '2';
+		append_to_buffer(mask, &mark, 1);
+		i++;
+	}
+}
+
+/**
+ * @brief Expands the operand of `${name:-word}`, `${name:=word}`,
+ * `${name:+word}` or `${name:?word}` and appends it to the buffer.
+ * 
+ * The operand of `?` is only expanded, for the error message. In a marked
+ * word (see expand_marked), the operand is expanded with its own marks.
+ * 
+ * @param ctx The context of the `${...}`.
+ * @param buffer The buffer the expansion is appended to.
+ * @param p The parameter.
+ * @return The expanded operand, to be freed, or NULL.
+ */
+char	*param_operand(t_token_context *ctx, t_dynamic_buffer *buffer,
+	t_param *p)
+{
+	t_dynamic_buffer	marks;
+	char				*word;
+
+	if (p->op == '?')
+		return (param_word(ctx, p->word));
+	if (!ctx->mask)
+	{
+		word = param_word(ctx, p->word);
+		if (word)
+			append_to_buffer(buffer, word, ft_strlen(word));
+		return (word);
+	}
+	ft_memset(&marks, 0, sizeof(t_dynamic_buffer));
+	word = expand_marked(p->word, ctx->shell, &marks);
+	if (word)
+	{
+		append_operand_marks(ctx->mask, &marks, buffer->size);
+		append_to_buffer(buffer, word, ft_strlen(word));
+	}
+	free_buffer(&marks);
+	return (word);
+}
@@ -18,10 +18,6 @@
 
 #include "env/env.h"
 
-void	handle_exit_status_in_quotes(t_token_context *ctx,
-			t_dynamic_buffer *buffer);
-void	add_var_value(t_token_context *ctx, t_dynamic_buffer *buffer,
-			char *var_value);
 void	handle_double_quotes(t_token_context *ctx,
 			t_dynamic_buffer *buffer);
 
@@ -63,10 +59,15 @@ static void	process_dquote_contents(t_token_context *ctx,
 	while (*ctx->ptr && *ctx->ptr != '"')
 	{
 		if (*ctx->ptr == '$' && (ft_isalnum(*(ctx->ptr + 1))
-				|| *(ctx->ptr + 1) == '?' || *(ctx->ptr + 1) == '$'))
+				|| is_special_param(*(ctx->ptr + 1))
+				|| *(ctx->ptr + 1) == '(' || *(ctx->ptr + 1) == '{'))
 		{
-			if (*(ctx->ptr + 1) == '?')
-				handle_exit_status_in_quotes(ctx, buffer);
+			if (is_special_param(*(ctx->ptr + 1)))
+				expand_special_param(ctx, buffer);
+			else if (*(ctx->ptr + 1) == '(')
+				expand_command_subst(ctx, buffer);
+			else if (*(ctx->ptr + 1) == '{')
+				expand_param_subst(ctx, buffer);
 			else
 				handle_env_variable(ctx, buffer);
 		}
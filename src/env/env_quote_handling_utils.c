@@ -20,9 +20,6 @@
 #include "core/dynamic_buffer.h"
 #include "types.h"
 
-static bool	handle_special_cases(t_token_context *ctx,
-				t_dynamic_buffer *buffer);
-
 /**
  * @brief Handles the variable name and appends its value to the buffer.
  * 
@@ -53,40 +50,6 @@ static void	handle_var_name(t_token_context *ctx,
 	safe_free((void **)&var_name);
 }
 
-/**
- * @brief Adds the variable value to the buffer.
- * 
- * This function handles the special case of the exit status variable.
- * 
- * @param ctx Token context.
- * @param buffer Destination buffer.
- * @param var_value The variable value to add.
- * 
- * This function is responsible for handling the special case of the exit
- * status variable. It converts the exit status to a string and appends it
- * to the buffer. The function also handles memory management by freeing
- * the variable value after use.
- * 
- */
-void	add_var_value(t_token_context *ctx, t_dynamic_buffer *buffer,
-	char *var_value)
-{
-	char	*status_str;
-
-	if (var_value)
-	{
-		append_to_buffer(buffer, var_value, ft_strlen(var_value));
-		return ;
-	}
-	status_str = ft_itoa(ctx->shell->exit_status);
-	if (status_str)
-	{
-		append_to_buffer(buffer, status_str, ft_strlen(status_str));
-		safe_free((void **)&status_str);
-	}
-	ctx->ptr++;
-}
-
 /**
  * @brief Handles environment variables in the input string.
  * 
@@ -100,8 +63,6 @@ void	handle_env_variable(t_token_context *ctx, t_dynamic_buffer *buffer)
 	char	*var_name;
 
 	ctx->ptr++;
-	if (handle_special_cases(ctx, buffer))
-		return ;
 	var_name = get_env_name(ctx->ptr);
 	if (var_name == NULL || ft_strlen(var_name) == 0)
 	{
@@ -111,48 +72,3 @@ void	handle_env_variable(t_token_context *ctx, t_dynamic_buffer *buffer)
 	}
 	handle_var_name(ctx, buffer, var_name);
 }
-
-/**
- * @brief Handles special cases for variable expansion.
- * 
- * This function checks for special cases like `$?` and `$`.
- * 
- * @param ctx Token context.
- * @param buffer Destination buffer.
- * @return true if a special case was handled, false otherwise.
- */
-static bool	handle_special_cases(t_token_context *ctx, t_dynamic_buffer *buffer)
-{
-	if (*ctx->ptr == '?')
-	{
-		add_var_value(ctx, buffer, NULL);
-		return (true);
-	}
-	if (*ctx->ptr == '$')
-	{
-		append_to_buffer(buffer, "$", 1);
-		ctx->ptr++;
-		return (true);
-	}
-	return (false);
-}
-
-/**
- * @brief Handles exit status variable expansion inside double quotes.
- * 
- * @param ctx Token context.
- * @param buffer Destination buffer.
- */
-void	handle_exit_status_in_quotes(t_token_context *ctx,
-	t_dynamic_buffer *buffer)
-{
-	char	*status_str;
-
-	status_str = ft_itoa(ctx->shell->exit_status);
-	if (status_str)
-	{
-		append_to_buffer(buffer, status_str, ft_strlen(status_str));
-		safe_free((void **)&status_str);
-	}
-	ctx->ptr += 2;
-}
@@ -27,13 +27,14 @@ int	safe_setenv(t_env **env, const char *name, const char *value, int overwrite)
 
 	if (!env || !name || !*name || ft_strchr(name, '='))
 		return (-1);
-	node = find_env_variable(*env, name);
-	if (node)
+	node = env_own(*env, name);
+	if (!node && *env)
+		return (-1);
+	if (node && ft_strcmp(node->key, name) == 0)
 	{
 		if (!overwrite)
 			return (0);
-		safe_free((void **)&node->value);
-		node->value = ft_strdup(value);
+		env_str_set(&node->value, env_str_new(value));
 		if (!node->value)
 			return (-1);
 	}
@@ -41,3 +42,33 @@ int	safe_setenv(t_env **env, const char *name, const char *value, int overwrite)
 		env_append_node(env, name, value);
 	return (0);
 }
+
+/**
+ * @brief Sets a variable to a shared string, without copying it.
+ *
+ * Used when the value comes from another variable, as on cd, where OLDPWD
+ * takes the string of PWD.
+ *
+ * @param env The environment list to modify.
+ * @param key The name of the variable.
+ * @param value A shared string, such as the value of a variable; the
+ * variable takes its own hold on it.
+ */
+void	env_set_shared(t_env *env, const char *key, char *value)
+{
+	t_env	*node;
+
+	if (!env || !key || !value)
+		return ;
+	node = env_own(env, key);
+	if (!node)
+		return ;
+	if (ft_strcmp(node->key, key) == 0)
+	{
+		env_str_set(&node->value, env_str_ref(value));
+		return ;
+	}
+	node->next = initialize_env_node(key, NULL);
+	if (node->next)
+		node->next->value = env_str_ref(value);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_snapshot.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:04:37 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 20:04:37 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_snapshot.c
+ * @brief Copy-on-write snapshots of the environment list.
+ * 
+ * The nodes of the list count the pointers to them (t_env.refs). A
+ * snapshot copies the head node only and shares every other node with the
+ * list it was taken from; the copied nodes share the strings of the
+ * original ones. A change made through one of the lists first
+ * copies the shared nodes between its head and the node it changes (path
+ * copying), so the other lists keep seeing the old ones. The head of a
+ * list is never shared, which lets every function taking a `t_env *`
+ * change its own list only.
+ */
+
+#include "env/env.h"
+
+/**
+ * @brief Takes a snapshot of an environment.
+ * 
+ * @param env The environment, unchanged.
+ * @return A new list with the same variables, to be freed with
+ * free_env_list, or NULL if env is empty or on allocation failure.
+ */
+t_env	*env_snapshot(t_env *env)
+{
+	t_env	*head;
+
+	if (!env)
+		return (NULL);
+	head = env_node_share(env);
+	if (!head)
+		return (NULL);
+	head->next = env->next;
+	if (head->next)
+		head->next->refs++;
+	return (head);
+}
+
+/**
+ * @brief Makes the nodes of a list, from its head to the variable key,
+ * its own, copying those that are shared with another list.
+ * 
+ * @param head The head of the list, not shared.
+ * @param key The name of the variable, or NULL to go to the last node.
+ * @return The node of the variable, or the last node if there is none,
+ * or NULL if head is NULL or on allocation failure.
+ */
+t_env	*env_own(t_env *head, const char *key)
+{
+	t_env	*node;
+	t_env	*copy;
+
+	node = head;
+	while (node && node->next
+		&& !(key && node->key && ft_strcmp(node->key, key) == 0))
+	{
+		if (node->next->refs > 1)
+		{
+			copy = env_snapshot(node->next);
+			if (!copy)
+				return (NULL);
+			node->next->refs--;
+			node->next = copy;
+		}
+		node = node->next;
+	}
+	return (node);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_special.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:48:22 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 16:48:22 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_special.c
+ * @brief Special parameters: `$?`, `$$`, `$!`, `$#`, `$0` and `$-`.
+ * 
+ * They are not variables: their values are read from the shell structure
+ * each time they are expanded, and a number is formatted into a buffer on
+ * the stack of the caller, so that expanding one allocates nothing.
+ */
+
+#include "env/env.h"
+#include "env/env_arith.h"
+
+/**
+ * @brief Tells whether a character names a special parameter.
+ * 
+ * @param c The character after the `$`.
+ * @return true for one of SPECIAL_PARAMS.
+ */
+bool	is_special_param(char c)
+{
+	return (c != '\0' && ft_strchr(SPECIAL_PARAMS, c) != NULL);
+}
+
+/**
+ * @brief Writes the letters of the shell options that are on (`$-`).
+ * 
+ * @param shell The shell.
+ * @param out The buffer, of at least ARITH_NUM_SIZE bytes.
+ * @return out.
+ */
+static const char	*shell_flags(t_shell *shell, char *out)
+{
+	size_t	len;
+
+	len = 0;
+	if (shell->interactive)
+		out[len++] = 'i';
+	if (shell->noclobber)
+		out[len++] = 'C';
+	out[len] = '\0';
+	return (out);
+}
+
+/**
+ * @brief Returns the value of a special parameter.
+ * 
+ * The shell takes no positional parameter, so `$#` is always 0.
+ * 
+ * @param shell The shell.
+ * @param name The name of the parameter.
+ * @param out The buffer the value is formatted into, of at least
+ * ARITH_NUM_SIZE bytes.
+ * @return The value, in out or held by the shell, or NULL when the
+ * parameter is unset (`$!` before any background process).
+ */
+const char	*special_param(t_shell *shell, char name, char *out)
+{
+	if (name == '0')
+		return (shell->name);
+	if (name == '-')
+		return (shell_flags(shell, out));
+	if (name == '!' && shell->last_bg <= 0)
+		return (NULL);
+	if (name == '?')
+		arith_format(shell->exit_status, out);
+	else if (name == '$')
+		arith_format(shell->pid, out);
+	else if (name == '!')
+		arith_format(shell->last_bg, out);
+	else
+		arith_format(0, out);
+	return (out);
+}
+
+/**
+ * @brief Expands the special parameter at the current position.
+ * 
+ * @param ctx Token context, at the `$`.
+ * @param buffer Destination buffer.
+ */
+void	expand_special_param(t_token_context *ctx, t_dynamic_buffer *buffer)
+{
+	char		num[ARITH_NUM_SIZE];
+	const char	*value;
+
+	value = special_param(ctx->shell, ctx->ptr[1], num);
+	ctx->ptr += 2;
+	if (value)
+		append_to_buffer(buffer, value, ft_strlen(value));
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_string.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:41:12 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 01:41:12 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_string.c
+ * @brief Reference-counted strings for the names and values of variables.
+ * 
+ * A string set once in the environment is never changed in place: a new
+ * value replaces it. It can thus be shared by the nodes of a list and its
+ * snapshots, and between variables holding the same value (OLDPWD takes
+ * the string of PWD on cd), instead of being copied each time.
+ */
+
+#include "env/env.h"
+
+void	*safe_malloc(size_t size);
+void	*ft_memcpy(void *dst, const void *src, size_t n);
+
+/**
+ * @brief Gets the header of a shared string.
+ * 
+ * @param s The characters of the string.
+ * @return The header in front of them.
+ */
+static t_env_str	*env_str_header(const char *s)
+{
+	return ((t_env_str *)s - 1);
+}
+
+/**
+ * @brief Copies a string into a new shared string.
+ * 
+ * @param s The string to copy, or NULL.
+ * @return The characters of the copy, held once by the caller, or NULL if
+ * s is NULL or on allocation failure.
+ */
+char	*env_str_new(const char *s)
+{
+	t_env_str	*str;
+	size_t		len;
+
+	if (!s)
+		return (NULL);
+	len = ft_strlen(s);
+	str = safe_malloc(sizeof(t_env_str) + len + 1);
+	if (!str)
+		return (NULL);
+	str->next = NULL;
+	str->refs = 1;
+	str->interned = false;
+	ft_memcpy(str + 1, s, len + 1);
+	return ((char *)(str + 1));
+}
+
+/**
+ * @brief Takes one more hold on a shared string.
+ * 
+ * @param s The shared string, or NULL.
+ * @return s.
+ */
+char	*env_str_ref(char *s)
+{
+	if (s)
+		env_str_header(s)->refs++;
+	return (s);
+}
+
+/**
+ * @brief Drops a hold on a shared string, freeing it with the last one.
+ * 
+ * @param s The shared string, or NULL.
+ */
+void	env_str_release(char *s)
+{
+	t_env_str	*str;
+
+	if (!s)
+		return ;
+	str = env_str_header(s);
+	str->refs--;
+	if (str->refs > 0)
+		return ;
+	if (str->interned)
+		env_intern_remove(s);
+	safe_free((void **)&str);
+}
+
+/**
+ * @brief Replaces the shared string held in a slot.
+ * 
+ * @param slot The slot, holding a shared string or NULL.
+ * @param s The new string, whose hold passes to the slot.
+ */
+void	env_str_set(char **slot, char *s)
+{
+	char	*old;
+
+	old = *slot;
+	*slot = s;
+	env_str_release(old);
+}
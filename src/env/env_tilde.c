@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_tilde.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:36:50 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 03:36:50 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_tilde.c
+ * @brief Tilde expansion, the first stage of the expansion of a word.
+ * 
+ * A word starting with `~` (or an assignment `name=~...`), up to the
+ * first `/`, is replaced with a home directory: `~` is $HOME, `~user`
+ * the home of user. The home directories looked up in the password
+ * database (with `~` when HOME is not set) are kept for the session, with
+ * the users that have none, so each user is looked up once. A `~user`
+ * with no such user is left as is.
+ */
+
+#include "env/env.h"
+#include "env/env_glob.h"
+#include <pwd.h>
+
+char	*ft_strndup(const char *s, size_t n);
+
+/**
+ * @brief Returns the cache of home directories singleton.
+ * 
+ * @return Address of the head of the cache.
+ */
+static t_home	**home_cache(void)
+{
+	static t_home	*cache = NULL;
+
+	return (&cache);
+}
+
+/**
+ * @brief Looks up the home directory of a user, in the cache first.
+ * 
+ * @param user The name of the user, freed or kept by the cache, or empty
+ * for the user running the shell.
+ * @return The home directory, or NULL if the user has none.
+ */
+static const char	*home_lookup(char *user)
+{
+	t_home			*home;
+	struct passwd	*pw;
+
+	home = *home_cache();
+	while (home && ft_strcmp(home->user, user) != 0)
+		home = home->next;
+	if (home)
+		return (free(user), home->dir);
+	home = safe_malloc(sizeof(t_home));
+	if (!home)
+		return (free(user), NULL);
+	home->user = user;
+	if (!*user)
+		pw = getpwuid(getuid());
+	else
+		pw = getpwnam(home->user);
+	home->dir = NULL;
+	if (pw && pw->pw_dir)
+		home->dir = ft_strdup(pw->pw_dir);
+	home->next = *home_cache();
+	*home_cache() = home;
+	return (home->dir);
+}
+
+/**
+ * @brief Measures the tilde prefix a word starts with.
+ * 
+ * @param word The word.
+ * @return The length of `~` or `~user`, or 0 if the word does not start
+ * with one (a quote, `$` or other special character is no user name).
+ */
+static size_t	tilde_len(const char *word)
+{
+	size_t	i;
+
+	if (word[0] != '~')
+		return (0);
+	i = 1;
+	while (word[i] && word[i] != '/')
+	{
+		if (!ft_isalnum(word[i]) && !ft_strchr("._-", word[i]))
+			return (0);
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Resolves a tilde prefix.
+ * 
+ * @param word The prefix, starting with `~`.
+ * @param len Its length.
+ * @param shell The shell, for HOME.
+ * @return The home directory, or NULL to leave the prefix as is.
+ */
+static const char	*tilde_home(const char *word, size_t len, t_shell *shell)
+{
+	const char	*home;
+	char		*user;
+
+	if (len == 1)
+	{
+		home = get_env_value("HOME", shell->env);
+		if (home)
+			return (home);
+	}
+	user = ft_strndup(word + 1, len - 1);
+	if (!user)
+		return (NULL);
+	return (home_lookup(user));
+}
+
+/**
+ * @brief Expands the tilde prefix of a word.
+ * 
+ * The home directory is quoted if needed, so that the quote removal and
+ * the pathname expansion that come later leave it as is.
+ * 
+ * @param token The word.
+ * @param shell The shell structure.
+ * @param len Set to the length of the prefix in the word, `name=`
+ * included, or to 0 when it is not expanded.
+ * @return The expanded prefix, to be freed, or NULL if the word has none.
+ */
+char	*tilde_prefix(const char *token, t_shell *shell, size_t *len)
+{
+	size_t		name;
+	size_t		tilde;
+	const char	*home;
+	char		*parts[2];
+	char		*prefix;
+
+	*len = 0;
+	name = env_assignment_len(token);
+	name += (name > 0);
+	tilde = tilde_len(token + name);
+	home = NULL;
+	if (tilde > 0)
+		home = tilde_home(token + name, tilde, shell);
+	if (!home)
+		return (NULL);
+	parts[0] = ft_strndup(token, name);
+	parts[1] = glob_quote(home);
+	prefix = NULL;
+	if (parts[0] && parts[1])
+		prefix = glob_join(parts[0], parts[1], "");
+	free(parts[0]);
+	free(parts[1]);
+	if (prefix)
+		*len = name + tilde;
+	return (prefix);
+}
@@ -26,28 +26,18 @@ bool	free_buffer(t_dynamic_buffer *buffer);
 void	*safe_malloc(size_t size);
 
 /**
- * * @brief Handles single quotes in the input string.
- * * @param ctx Token context.
+ * * @brief Expands a special parameter (`$?`, `$$`...), a `$(list)`
+ * * command substitution or a `${...}` parameter expansion.
+ * * @param ctx Token context, at the `$`.
  * * @param buffer Destination buffer.
- * *
- * * @note This function handles environment variables inside single quotes.
  */
-static void	copy_exit_status(t_token_context *ctx, t_dynamic_buffer *buffer)
+static void	copy_special_param(t_token_context *ctx, t_dynamic_buffer *buffer)
 {
-	char	*status_str;
-	size_t	value_len;
-	int		status;
-
-	status = 0;
-	if (ctx && ctx->shell)
-		status = ctx->shell->exit_status;
-	status_str = ft_itoa(status);
-	if (status_str)
-	{
-		value_len = ft_strlen(status_str);
-		append_to_buffer(buffer, status_str, value_len);
-		safe_free((void **)&status_str);
-	}
+	if (*(ctx->ptr + 1) == '(')
+		return (expand_command_subst(ctx, buffer));
+	if (*(ctx->ptr + 1) == '{')
+		return (expand_param_subst(ctx, buffer));
+	expand_special_param(ctx, buffer);
 }
 
 /**
@@ -56,29 +46,22 @@ static void	copy_exit_status(t_token_context *ctx, t_dynamic_buffer *buffer)
  * @param buffer Destination buffer.
  * 
  * This function processes a character in the input string, handling
- * special characters, quotes, and environment variables.
+ * special characters, quotes, and environment variables. A quoted part is
+ * handled up to its closing quote.
  * 
  * @note This function is used by the replace_env_variables function.
  * 
  */
 static void	process_token_char(t_token_context *ctx, t_dynamic_buffer *buffer)
 {
-	if (*ctx->ptr == '$' && *(ctx->ptr + 1) == '?')
-	{
-		copy_exit_status(ctx, buffer);
-		ctx->ptr += 2;
-	}
-	else if (*ctx->ptr == '\'' && !ctx->in_double_quote)
-	{
-		ctx->in_single_quote = !ctx->in_single_quote;
+	if (*ctx->ptr == '$' && (is_special_param(*(ctx->ptr + 1))
+			|| *(ctx->ptr + 1) == '(' || *(ctx->ptr + 1) == '{'))
+		copy_special_param(ctx, buffer);
+	else if (*ctx->ptr == '\'')
 		handle_single_quotes(ctx, buffer);
-	}
-	else if (*ctx->ptr == '"' && !ctx->in_single_quote)
-	{
-		ctx->in_double_quote = !ctx->in_double_quote;
+	else if (*ctx->ptr == '"')
 		handle_double_quotes(ctx, buffer);
-	}
-	else if (*ctx->ptr == '$' && !ctx->in_single_quote && *(ctx->ptr + 1)
+	else if (*ctx->ptr == '$' && *(ctx->ptr + 1)
 		&& (ft_isalnum(*(ctx->ptr + 1)) || *(ctx->ptr + 1) == '_'))
 		handle_env_variable(ctx, buffer);
 	else
@@ -88,23 +71,6 @@ static void	process_token_char(t_token_context *ctx, t_dynamic_buffer *buffer)
 	}
 }
 
-/**
- * * @brief Frees the token context structure.
- * * @param ctx Pointer to the token context structure to free.
- * 
- * * This function frees the memory allocated for the token context
- * * structure and sets the pointer to NULL.
- * * @note This function should be called when the token context is no
- * * longer needed to prevent memory leaks.
- */
-void	free_token_context(t_token_context **ctx)
-{
-	if (!ctx || !*ctx)
-		return ;
-	safe_free((void **) ctx);
-	*ctx = NULL;
-}
-
 /**
  * @brief Initializes a token context structure.
  * 
@@ -133,8 +99,7 @@ t_token_context	*init_token_context(const char *token, t_env *env,
 	ctx->shell = shell;
 	ctx->current_var_value = NULL;
 	ctx->current_var = NULL;
-	ctx->in_single_quote = false;
-	ctx->in_double_quote = false;
+	ctx->mask = NULL;
 	return (ctx);
 }
 
@@ -152,28 +117,49 @@ t_token_context	*init_token_context(const char *token, t_env *env,
  * @note The returned token must be freed after use to prevent memory leaks.
  */
 char	*replace_env_variables(const char *token, t_shell *shell)
+{
+	return (expand_marked(token, shell, NULL));
+}
+
+/**
+ * @brief Replaces environment variables in a token, marking the origin of
+ * each byte of the result.
+ * 
+ * The mask receives one byte per byte of the result: '1' where it comes
+ * from an unquoted expansion (`$VAR`, `$?`, `$(...)`, `${...}`), which
+ * field splitting may split and whose quotes are literal, '0' for a quoted
+ * or literal byte. The text of a `${name:-word}` operand is marked '2' by
+ * param_operand: split, but its quotes are shell quotes.
+ * 
+ * @param token Token to process.
+ * @param shell The shell structure.
+ * @param mask The buffer the marks are appended to, or NULL.
+ * @return The token with environment variables replaced, to be freed.
+ */
+char	*expand_marked(const char *token, t_shell *shell,
+	t_dynamic_buffer *mask)
 {
 	t_token_context		*ctx;
 	t_dynamic_buffer	buffer;
-	char				*result;
+	char				origin;
 
 	if (!token)
 		return (ft_strdup(""));
 	if (!shell || !shell->env)
 		return (ft_strdup(token));
 	ctx = init_token_context(token, shell->env, shell);
-	if (!ctx)
-		return (ft_strdup(token));
-	if (!init_buffer(&buffer, INITIAL_BUFFER_SIZE))
-	{
-		free_token_context(&ctx);
-		return (ft_strdup(token));
-	}
+	if (!ctx || !init_buffer(&buffer, INITIAL_BUFFER_SIZE))
+		return (safe_free((void **)&ctx), ft_strdup(token));
 	while (*ctx->ptr)
+	{
+		origin = '0' + (*ctx->ptr == '$');
+		ctx->mask = NULL;
+		if (origin == '1')
+			ctx->mask = mask;
 		process_token_char(ctx, &buffer);
-	result = buffer.data;
-	buffer.data = NULL;
-	free_buffer(&buffer);
-	free_token_context(&ctx);
-	return (result);
+		while (mask && mask->size < buffer.size)
+			append_to_buffer(mask, &origin, 1);
+	}
+	safe_free((void **)&ctx);
+	return (buffer.data);
 }
@@ -30,67 +30,6 @@
 
 bool	init_buffer(t_dynamic_buffer *buffer, size_t initial_capacity);
 
-/**
- * @brief Updates the value of an existing environment variable.
- *
- * @param env The environment list to search in.
- * @param key The key of the environment variable to update.
- * @param value The new value to set.
- *
- * @note This function assumes the key exists in the environment list.
- * It frees the old value and allocates memory for the new value.
- */
-static void	update_existing_env_value(t_env *env,
-	const char *key, const char *value)
-{
-	t_env	*current;
-
-	current = env;
-	while (current)
-	{
-		if (ft_strcmp(current->key, key) == 0)
-		{
-			safe_free((void **)&current->value);
-			current->value = ft_strdup(value);
-			return ;
-		}
-		current = current->next;
-	}
-}
-
-/**
- * @brief Appends a new environment variable to the end of the environment list.
- *
- * @param env Pointer to the environment list.
- * @param key The key of the new environment variable.
- * @param value The value of the new environment variable.
- *
- * @note This function creates a new node and appends it to the end of the list.
- * If the list is empty, the new node becomes the head of the list.
- */
-static void	append_new_env_value(t_env **env,
-	const char *key, const char *value)
-{
-	t_env	*current;
-	t_env	*last;
-	t_env	*new_node;
-
-	current = *env;
-	last = NULL;
-	while (current)
-	{
-		last = current;
-		current = current->next;
-	}
-	new_node = initialize_env_node(key, value);
-	if (!new_node)
-		return ;
-	if (!last)
-		*env = new_node;
-	else
-		last->next = new_node;
-}
-
 /**
  * @brief Sets or updates an environment variable in the environment list.
  *
@@ -98,28 +37,21 @@ static void	append_new_env_value(t_env **env,
  * @param key The key of the environment variable to set.
  * @param value The value to set for the environment variable.
  *
- * @note If the key already exists in the environment list, its value is updated.
- * If the key doesn't exist, a new environment variable is appended to the list.
- * The function handles memory allocation for storing the new value.
- * If any parameter is NULL, the function returns without making any changes.
+ * @note The value is copied once into a shared string, which env_set_shared
+ * stores. If any parameter is NULL, the function returns without making
+ * any changes.
  */
 void	env_set_value(t_env *env, const char *key, const char *value)
 {
-	t_env	*current;
+	char	*shared;
 
 	if (!env || !key || !value)
 		return ;
-	current = env;
-	while (current)
-	{
-		if (ft_strcmp(current->key, key) == 0)
-		{
-			update_existing_env_value(env, key, value);
-			return ;
-		}
-		current = current->next;
-	}
-	append_new_env_value(&env, key, value);
+	shared = env_str_new(value);
+	if (!shared)
+		return ;
+	env_set_shared(env, key, shared);
+	env_str_release(shared);
 }
 
 /**
@@ -142,6 +74,21 @@ char	*get_env_value(const char *key, t_env *env)
 		return (NULL);
 }
 
+/**
+ * @brief Tells whether a variable is readonly.
+ *
+ * @param env The environment list.
+ * @param key The name of the variable.
+ * @return true if it is set and has the ENV_READONLY flag.
+ */
+bool	env_is_readonly(t_env *env, const char *key)
+{
+	t_env	*node;
+
+	node = find_env_variable(env, key);
+	return (node && (node->flags & ENV_READONLY));
+}
+
 /**
  * @brief Initializes a basic environment with the current working directory.
  * @param env The environment list to initialize.
@@ -159,6 +106,5 @@ void	init_basic_env(t_env **env)
 	pwd = getcwd(buffer, PATH_MAX);
 	if (pwd)
 		env_append_node(env, "PWD", pwd);
-	env_append_node(env, "?", "0");
 	safe_free((void **)&pwd);
 }
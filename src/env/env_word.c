@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_word.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:31:17 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 15:31:17 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file env_word.c
+ * @brief Expansion of a word of the line: tilde expansion, then the `$`
+ * expansions (replace_env_variables), then field splitting for the words
+ * of a command.
+ */
+
+#include "minishell.h"
+#include "env/env_fields.h"
+
+bool	is_arith_command(const char *token);
+
+/**
+ * @brief Expands a word without splitting it.
+ * 
+ * @param token The word.
+ * @param shell The shell structure.
+ * @return The expanded word, to be freed.
+ */
+char	*word_expand(const char *token, t_shell *shell)
+{
+	size_t	len;
+	char	*prefix;
+	char	*rest;
+	char	*word;
+
+	prefix = tilde_prefix(token, shell, &len);
+	if (!prefix)
+		return (replace_env_variables(token, shell));
+	rest = replace_env_variables(token + len, shell);
+	word = NULL;
+	if (rest)
+		word = glob_join(prefix, rest, "");
+	free(prefix);
+	free(rest);
+	return (word);
+}
+
+/**
+ * @brief Expands a word, marking the bytes that field splitting may split.
+ * 
+ * @param token The word.
+ * @param shell The shell structure.
+ * @param mask Receives the marks of the bytes after the tilde prefix.
+ * @param quoted Set to the length of the expanded tilde prefix.
+ * @return The expanded word, to be freed.
+ */
+static char	*word_expand_marked(const char *token, t_shell *shell,
+	t_dynamic_buffer *mask, size_t *quoted)
+{
+	size_t	len;
+	char	*prefix;
+	char	*rest;
+	char	*word;
+
+	*quoted = 0;
+	prefix = tilde_prefix(token, shell, &len);
+	rest = expand_marked(token + len, shell, mask);
+	if (!prefix)
+		return (rest);
+	word = NULL;
+	if (rest)
+		word = glob_join(prefix, rest, "");
+	*quoted = ft_strlen(prefix);
+	free(prefix);
+	free(rest);
+	return (word);
+}
+
+/**
+ * @brief Expands a word and appends its fields to the words of the line.
+ * 
+ * @param token The word.
+ * @param shell The shell structure.
+ * @param out The words of the line.
+ * @return false on allocation failure.
+ */
+bool	word_fields(const char *token, t_shell *shell, t_str_vec *out)
+{
+	t_fields			f;
+	t_dynamic_buffer	mask;
+	char				*word;
+	bool				ok;
+
+	ft_memset(&mask, 0, sizeof(t_dynamic_buffer));
+	word = word_expand_marked(token, shell, &mask, &f.quoted);
+	f.word = word;
+	f.origin = mask.data;
+	f.origin_len = mask.size;
+	f.ifs = get_env_value("IFS", shell->env);
+	if (!f.ifs)
+		f.ifs = IFS_DEFAULT;
+	f.quote = '\0';
+	f.out = out;
+	ok = (word && split_fields(&f));
+	free(word);
+	free_buffer(&mask);
+	return (ok);
+}
+
+/**
+ * @brief Tells whether a word of the line is split into fields.
+ * 
+ * Operators, redirection targets, `((expr))` and assignment words are
+ * expanded into a single word. For an assignment, this goes for the
+ * arguments of export and readonly too, as bash does for its declaration
+ * builtins.
+ * 
+ * @param tokens The words of the line.
+ * @param i The index of the word.
+ * @return true if the word is split.
+ */
+bool	word_splits(char **tokens, size_t i)
+{
+	if (is_operator_token(tokens[i]) || is_arith_command(tokens[i])
+		|| env_assignment_len(tokens[i]) > 0)
+		return (false);
+	return (i == 0 || !is_redirection_token(tokens[i - 1]));
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   assignments.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:02:16 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 03:02:16 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file assignments.c
+ * @brief Assignment words before a command.
+ * 
+ * The leading `name=value` words of a command are taken out of its
+ * arguments. Alone, they are an assignment statement, setting shell
+ * variables. Before a command, they are exported to it only: they are
+ * made on the shell's environment, whose snapshot taken before is used to
+ * undo them once the command was launched (or has run, for a builtin).
+ */
+
+#include "minishell.h"
+#include "executor/executor.h"
+
+int		get_fd_from_str(void *str);
+
+/**
+ * @brief Counts the leading assignment words of a command.
+ * 
+ * @param args The arguments of the command.
+ * @return The number of assignment words.
+ */
+static size_t	prefix_len(char **args)
+{
+	size_t	n;
+
+	n = 0;
+	while (args[n] && env_assignment_len(args[n]))
+		n++;
+	return (n);
+}
+
+/**
+ * @brief Takes the leading assignment words out of the arguments of a
+ * command, which then starts at its name, if it has one.
+ * 
+ * @param node The command node.
+ * @return The assignment words, NULL-terminated, or NULL if there are
+ * none or on allocation failure.
+ */
+char	**assign_take_prefix(t_ast_node *node)
+{
+	char	**args;
+	char	**words;
+	size_t	n;
+	size_t	i;
+
+	args = node->data.command.args;
+	n = prefix_len(args);
+	if (n == 0)
+		return (NULL);
+	words = safe_malloc(sizeof(char *) * (n + 1));
+	if (!words)
+		return (NULL);
+	ft_memcpy(words, args, sizeof(char *) * n);
+	words[n] = NULL;
+	i = 0;
+	while (args[i])
+	{
+		if (i >= n)
+			args[i - n] = args[i];
+		i++;
+	}
+	args[i - n] = NULL;
+	safe_free((void **)&node->data.command.name);
+	node->data.command.name = ft_strdup(args[0]);
+	return (words);
+}
+
+/**
+ * @brief Runs an assignment statement, made of assignment words only.
+ * 
+ * The variables set are shell variables, or stay exported if they were.
+ * As a stage of a pipeline, which is a subshell, it changes nothing.
+ * 
+ * @param words The assignment words, freed, or NULL.
+ * @param shell The shell struct.
+ * @param is_pipe If the statement is a stage of a pipeline.
+ * @return The fd of the (empty) output.
+ */
+int	assign_statement(char **words, t_shell *shell, int is_pipe)
+{
+	size_t	i;
+
+	shell->exit_status = 0;
+	i = 0;
+	while (words && words[i] && !is_pipe)
+	{
+		if (!env_assign_word(&shell->env, words[i], 0))
+		{
+			shell->exit_status = 1;
+			break ;
+		}
+		i++;
+	}
+	if (words)
+		free_array(words);
+	if (is_pipe)
+		return (get_fd_from_str(""));
+	return (-1);
+}
+
+/**
+ * @brief Undoes the assignments made for a command and frees them.
+ * 
+ * @param words The assignment words.
+ * @param shell The shell struct.
+ * @param saved The snapshot of the environment taken before them.
+ */
+void	assign_restore(char **words, t_shell *shell, t_env *saved)
+{
+	size_t	i;
+
+	i = 0;
+	while (words[i])
+	{
+		words[i][env_assignment_len(words[i])] = '\0';
+		env_restore(&shell->env, saved, words[i]);
+		i++;
+	}
+	free_env_list(saved);
+	free_array(words);
+}
+
+/**
+ * @brief Makes the assignments that come before a command, exported.
+ * 
+ * @param words The assignment words.
+ * @param shell The shell struct.
+ * @param saved Set to the snapshot of the environment taken before them.
+ * @return false if one failed, the others being undone, the words freed
+ * and the status set to 1.
+ */
+bool	assign_apply(char **words, t_shell *shell, t_env **saved)
+{
+	size_t	i;
+
+	*saved = env_snapshot(shell->env);
+	i = 0;
+	while (words[i])
+	{
+		if (!env_assign_word(&shell->env, words[i], ENV_EXPORTED))
+		{
+			assign_restore(words, shell, *saved);
+			shell->exit_status = 1;
+			return (false);
+		}
+		i++;
+	}
+	return (true);
+}
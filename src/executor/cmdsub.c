@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsub.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file cmdsub.c
+ * @brief Runs the list of a command substitution and captures its output.
+ * 
+ * The list is parsed into a subshell node and run in a child whose
+ * standard output is a pipe. The shell reads the pipe straight into a
+ * dynamic buffer: a small output takes a few reads, and once an output
+ * reaches CMDSUB_LARGE_OUTPUT the pipe is enlarged and the rest is read
+ * with read_all_fd, in chunks that grow with the buffer.
+ */
+
+#include "minishell.h"
+#include "executor/cmdsub.h"
+
+void	free_ast_node(t_ast_node **node);
+bool	read_all_fd(int fd, t_dynamic_buffer *buffer);
+
+#ifdef F_SETPIPE_SZ
+
+/**
+ * @brief Enlarges the pipe a large output is read from.
+ * 
+ * The writer then blocks less often and every read returns more data.
+ * 
+ * @param fd The read end of the pipe.
+ */
+static void	grow_pipe(int fd)
+{
+	fcntl(fd, F_SETPIPE_SZ, CMDSUB_PIPE_SIZE);
+}
+
+#else
+
+static void	grow_pipe(int fd)
+{
+	(void)fd;
+}
+
+#endif
+
+/**
+ * @brief Reads the whole output of a command substitution.
+ * 
+ * Trailing newlines are removed, as the substitution requires.
+ * 
+ * @param fd The read end of the pipe.
+ * @param out The capture buffer, with room for CMDSUB_LARGE_OUTPUT bytes.
+ * @return False on read or allocation error.
+ */
+static bool	read_output(int fd, t_dynamic_buffer *out)
+{
+	ssize_t	bytes;
+
+	bytes = 1;
+	while (bytes > 0 && out->size < CMDSUB_LARGE_OUTPUT)
+	{
+		bytes = read(fd, out->data + out->size,
+				out->capacity - out->size - 1);
+		if (bytes > 0)
+			out->size += bytes;
+	}
+	if (bytes > 0)
+		grow_pipe(fd);
+	if (bytes < 0 || (bytes > 0 && !read_all_fd(fd, out)))
+		return (false);
+	while (out->size > 0 && out->data[out->size - 1] == '\n')
+		out->size--;
+	out->data[out->size] = '\0';
+	return (true);
+}
+
+/**
+ * @brief Runs a list in a subshell and captures its standard output.
+ * 
+ * The exit status of the list becomes the status of the shell, until the
+ * command that uses the substitution sets its own.
+ * 
+ * @param list The start of the list.
+ * @param len The length of the list.
+ * @param shell The shell structure.
+ * @param out The buffer that receives the output, to be freed by the
+ * caller whatever the result.
+ * @return False if the list could not be run or its output read.
+ */
+bool	capture_command(const char *list, size_t len, t_shell *shell,
+			t_dynamic_buffer *out)
+{
+	t_ast_node	*subshell;
+	int			fds[2];
+	pid_t		pid;
+	int			status;
+	bool		ok;
+
+	if (!init_buffer(out, CMDSUB_BUFFER_SIZE))
+		return (false);
+	subshell = parse_subshell(list, len, shell);
+	if (!subshell || create_pipe(fds) == -1)
+		return (free_ast_node(&subshell), false);
+	pid = create_child_process();
+	if (pid == 0)
+		run_subshell(subshell, fds, STDOUT_FILENO, shell);
+	free_ast_node(&subshell);
+	close(fds[1]);
+	ok = (pid > 0 && read_output(fds[0], out));
+	close(fds[0]);
+	if (pid > 0 && shell_wait(shell, pid, &status, 0) > 0)
+		preserve_command_exit_status(shell, status);
+	return (ok);
+}
@@ -32,6 +32,7 @@ void	print_fd(int fd);
 int		handle_system_cmd(t_ast_node *node,
 			t_shell *shell, int fd_in, int is_pipe);
 int		handle_node_command(t_ast_node *node_cpy, t_shell *shell, int *is_pipe);
+bool	is_standalone_builtin(t_ast_node *node);
 
 /**
  * @brief Wait for all child processes to finish
@@ -44,32 +45,41 @@ static void	wait_for_processes(t_shell *shell)
 	int		status;
 	pid_t	pid;
 
-	pid = waitpid(-1, &status, WNOHANG);
+	pid = shell_wait(shell, -1, &status, WNOHANG);
 	while (pid > 0)
 	{
-		preserve_command_exit_status(shell, status);
-		pid = waitpid(-1, &status, WNOHANG);
+		if (!procsub_reaped(shell, pid))
+			preserve_command_exit_status(shell, status);
+		pid = shell_wait(shell, -1, &status, WNOHANG);
 	}
 }
 
 /**
  * @brief Wait for all child processes to finish and return the last status
  * 
- * @param void
+ * Process substitutions do not count for the status.
+ * 
+ * @param shell Shell struct
  * @return int The last status of the child processes
  */
-static int	wait_for_children(void)
+static int	wait_for_children(t_shell *shell)
 {
-	int	status;
-	int	last_status;
+	int		status;
+	int		last_status;
+	pid_t	pid;
 
 	last_status = 0;
-	while (wait(&status) > 0)
+	pid = shell_wait(shell, -1, &status, 0);
+	while (pid > 0)
 	{
-		if (WIFEXITED(status))
-			last_status = WEXITSTATUS(status);
-		else if (WIFSIGNALED(status))
-			last_status = 128 + WTERMSIG(status);
+		if (!procsub_reaped(shell, pid))
+		{
+			if (WIFEXITED(status))
+				last_status = WEXITSTATUS(status);
+			else if (WIFSIGNALED(status))
+				last_status = 128 + WTERMSIG(status);
+		}
+		pid = shell_wait(shell, -1, &status, 0);
 	}
 	return (last_status);
 }
@@ -77,6 +87,10 @@ static int	wait_for_children(void)
 /**
  * @brief Execute a single command and handle its output
  *
+ * A builtin alone takes a fast path: it writes its output itself and
+ * forks nothing, so there is no standard output to save and no child to
+ * wait for.
+ *
  * @param current Current AST node
  * @param shell Shell struct
  * @return Whether the command was handled
@@ -87,9 +101,13 @@ static int	execute_single_command(t_ast_node **current, t_shell *shell)
 	int		original_term;
 	int		final_fd;
 	bool	is_more;
-	char	local_buffer[EXEC_BUFFER_SIZE];
 
-	original_stdout = dup(STDOUT_FILENO);
+	if (is_standalone_builtin(*current))
+	{
+		flush_output_fd(execute_command(current, shell, 0), false);
+		return (1);
+	}
+	original_stdout = dup_cloexec(STDOUT_FILENO);
 	original_term = isatty(STDOUT_FILENO);
 	is_more = is_more_last_command(*current);
 	final_fd = execute_command(current, shell, 0);
@@ -99,13 +117,7 @@ static int	execute_single_command(t_ast_node **current, t_shell *shell)
 			dup2(original_stdout, STDOUT_FILENO);
 		close(original_stdout);
 	}
-	if (final_fd != -1)
-	{
-		if (is_more)
-			more_execution(final_fd, local_buffer, sizeof(local_buffer));
-		else
-			print_fd(final_fd);
-	}
+	flush_output_fd(final_fd, is_more);
 	wait_for_processes(shell);
 	return (1);
 }
@@ -134,6 +146,9 @@ static void	handle_command_execution(t_ast_node *current, t_shell *shell)
 /**
  * @brief Execute command
  * 
+ * Once the status is known, the atomic outputs of the line replace their
+ * targets, or are discarded if it failed.
+ * 
  * @param ast the ast
  * @param shell the shell struct
  */
@@ -141,7 +156,6 @@ void	execute_ast(t_ast *ast, t_shell *shell)
 {
 	int		final_fd;
 	bool	is_more;
-	char	local_buffer[EXEC_BUFFER_SIZE];
 
 	if (!ast || !ast->root)
 		return ;
@@ -149,15 +163,12 @@ void	execute_ast(t_ast *ast, t_shell *shell)
 	{
 		is_more = is_more_last_command(ast->root);
 		final_fd = execute_command(&ast->root, shell, 1);
-		if (final_fd != -1)
-		{
-			if (is_more)
-				more_execution(final_fd, local_buffer, sizeof(local_buffer));
-			else
-				print_fd(final_fd);
-		}
-		shell->exit_status = wait_for_children();
+		flush_output_fd(final_fd, is_more);
+		shell->exit_status = wait_for_children(shell);
+		if (pipeline_redir_failed(ast->root))
+			shell->exit_status = 1;
 	}
 	else
 		handle_command_execution(ast->root, shell);
+	redir_plan_commit(ast->root, shell->exit_status);
 }
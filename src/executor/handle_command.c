@@ -16,10 +16,104 @@
 int		compact_args(char **args, int *i_ptr, int *j_ptr);
 int		handle_builtin_command(t_ast_node *node_cpy, t_shell *shell);
 int		is_builtin_command(const char *command_name);
+int		handle_builtin_with_plan(t_ast_node *node, t_shell *shell,
+			int is_pipe);
+
+/**
+ * @brief Ends the subshell a builtin of a pipeline ran in: drops the
+ * snapshot of the environment it used and goes back to the directory
+ * the shell was in.
+ * 
+ * @param shell the shell struct
+ * @param env the environment of the shell
+ * @param cwd a descriptor of the directory of the shell, or -1
+ */
+static void	leave_subshell(t_shell *shell, t_env *env, int cwd)
+{
+	free_env_list(shell->env);
+	shell->env = env;
+	if (cwd < 0)
+		return ;
+	if (fchdir(cwd) == -1)
+		perror("minishell: fchdir");
+	close(cwd);
+}
+
+/**
+ * @brief Runs a builtin.
+ * 
+ * Every stage of a pipeline is a subshell. A builtin stage run by the
+ * shell itself gets a copy-on-write snapshot of the environment, and the
+ * directory it may change to is undone, so that what it changes (export,
+ * unset, cd...) is dropped once it has run, as in a forked stage.
+ * 
+ * @param node the command node
+ * @param shell the shell struct
+ * @param is_pipe if the command is a pipe
+ * 
+ * @return the fd of the out
+ */
+static int	run_builtin(t_ast_node *node, t_shell *shell, int is_pipe)
+{
+	t_env	*env;
+	int		cwd;
+	int		fd;
+
+	env = shell->env;
+	cwd = -1;
+	if (is_pipe)
+	{
+		shell->env = env_snapshot(env);
+		cwd = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	}
+	if (node->redir_plan)
+		fd = handle_builtin_with_plan(node, shell, is_pipe);
+	else
+		fd = handle_builtin_command(node, shell);
+	if (is_pipe)
+		leave_subshell(shell, env, cwd);
+	return (fd);
+}
+
+/**
+ * @brief Runs a command as a builtin or as a system command.
+ *
+ * Its leading assignment words are an assignment statement when nothing
+ * follows them, and otherwise only apply to the command.
+ *
+ * @param node_cpy the node
+ * @param shell the shell struct
+ * @param is_pipe if the command is a pipe
+ *
+ * @return the fd of the out
+ */
+static int	dispatch_command(t_ast_node *node_cpy, t_shell *shell, int is_pipe)
+{
+	char	**words;
+	t_env	*saved;
+	int		fd;
+
+	words = assign_take_prefix(node_cpy);
+	if (words && !node_cpy->data.command.args[0])
+		return (assign_statement(words, shell, is_pipe));
+	if (words && !assign_apply(words, shell, &saved))
+		return (assign_statement(NULL, shell, is_pipe));
+	if (is_builtin_command(node_cpy->data.command.name))
+		fd = run_builtin(node_cpy, shell, is_pipe);
+	else
+		fd = handle_system_cmd(node_cpy, shell, node_cpy->fd_in, is_pipe);
+	if (words)
+		assign_restore(words, shell, saved);
+	return (fd);
+}
 
 /**
  * @brief Handle node command
  *
+ * The process substitutions among the arguments are started right before
+ * the command, and the shell's ends of their pipes closed right after it
+ * was launched.
+ *
  * @param node_cpy the node
  * @param shell the shell struct
  * @param is_pipe if the command is a pipe
@@ -46,9 +140,11 @@ int	handle_node_command(t_ast_node *node_cpy, t_shell *shell, int *is_pipe)
 	if (is_pipe)
 		is_pipe_value = *is_pipe;
 	node_cpy->is_pipe = is_pipe_value;
-	if (is_builtin_command(node_cpy->data.command.name))
-		return (handle_builtin_command(node_cpy, shell));
-	return (handle_system_cmd(node_cpy, shell, node_cpy->fd_in, is_pipe_value));
+	if (!procsub_expand(args, shell))
+		return (-1);
+	i = dispatch_command(node_cpy, shell, is_pipe_value);
+	procsub_close(shell);
+	return (i);
 }
 
 /**
@@ -72,6 +168,6 @@ int	execute_command(t_ast_node **node, t_shell *shell, int is_pipe)
 	if (node_cpy->type == NODE_COMMAND)
 		return (handle_command_node(node_cpy, shell, is_pipe));
 	if (node_cpy->type == NODE_REDIRECTION)
-		return (handle_redirection_node(node_cpy, shell));
+		return (handle_redirection_node(node_cpy, shell, is_pipe));
 	return (-1);
 }
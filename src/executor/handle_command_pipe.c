@@ -13,11 +13,8 @@
 #include "minishell.h"
 #include "executor/executor.h"
 
-int		process_redirection(t_ast_node *node_cpy, t_shell *shell);
 int		handle_node_command(t_ast_node *node_cpy, t_shell *shell,
 			int *is_pipe);
-int		handle_heredoc(const char *delimiter);
-int		execute_from_cmd_node(t_ast_node *cmd, t_shell *shell, int out_fd);
 void	execute_child(t_ast_node *node, t_shell *shell, int pipe_fds[2]);
 int		execute_parent(t_ast_node *node, t_shell *shell,
 			int pipe_fds[2], pid_t pid);
@@ -25,70 +22,30 @@ int		handle_ls_case(t_ast_node *node, t_shell *shell);
 int		process_pipe_left(t_ast_node *left_node, t_shell *shell);
 
 /**
- * @brief Handles heredoc redirection execution.
+ * @brief Processes the right side of a pipe when it has redirections.
  * 
- * @param node Redirection node with heredoc.
- * @param shell Shell state.
- * @return int Resulting file descriptor.
- */
-int	handle_heredoc_redir(t_ast_node *node, t_shell *shell)
-{
-	int				heredoc_fd;
-	t_ast_node		*cmd;
-	int				fd;
-
-	heredoc_fd = handle_heredoc(node->data.redirection.file);
-	if (heredoc_fd <= 0)
-		return (STDIN_FILENO);
-	cmd = node->data.redirection.child;
-	while (cmd && cmd->type == NODE_REDIRECTION)
-		cmd = cmd->data.redirection.child;
-	if (cmd && cmd->type == NODE_COMMAND)
-	{
-		cmd->fd_in = heredoc_fd;
-		fd = execute_from_cmd_node(cmd, shell, node->fd_out);
-		if (heredoc_fd > 2)
-			close(heredoc_fd);
-		return (fd);
-	}
-	close(heredoc_fd);
-	return (STDIN_FILENO);
-}
-
-/**
- * @brief Handles input redirection execution.
+ * The command at the end of the redirection chain reads from the pipe;
+ * its redirection plan is applied on top of that when it is launched.
  * 
- * @param node Redirection node with input.
- * @param shell Shell state.
- * @return int Resulting file descriptor.
+ * @param right_node The outermost redirection node.
+ * @param left_fd The input file descriptor from the left pipe.
+ * @param shell The shell state.
+ * @param is_pipe Whether it's part of a pipe chain.
+ * @return int The output file descriptor.
  */
-int	handle_input_redir(t_ast_node *node, t_shell *shell)
+int	process_pipe_right_redirection(t_ast_node *right_node,
+	int left_fd, t_shell *shell, int is_pipe)
 {
 	t_ast_node	*cmd;
-	int			dup_fd;
+	t_ast_node	*temp;
 
-	if (!process_redirection(node, shell))
-		return (STDIN_FILENO);
-	cmd = node->data.redirection.child;
+	cmd = right_node;
 	while (cmd && cmd->type == NODE_REDIRECTION)
 		cmd = cmd->data.redirection.child;
-	if (!cmd || cmd->type != NODE_COMMAND)
-		return (STDIN_FILENO);
-	if (node->fd_in > 2)
-	{
-		cmd->fd_in = node->fd_in;
-		if (cmd->data.command.args && cmd->data.command.args[1]
-			&& node->fd_out != STDOUT_FILENO)
-		{
-			dup_fd = dup(cmd->fd_in);
-			if (dup_fd != -1)
-			{
-				close(cmd->fd_in);
-				cmd->fd_in = dup_fd;
-			}
-		}
-	}
-	return (execute_from_cmd_node(cmd, shell, node->fd_out));
+	if (cmd)
+		cmd->fd_in = left_fd;
+	temp = right_node;
+	return (execute_command(&temp, shell, is_pipe));
 }
 
 /**
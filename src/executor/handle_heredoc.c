@@ -6,144 +6,188 @@
 /*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/11 16:54:47 by yagoairm2         #+#    #+#             */
-/*   Updated: 2025/04/14 09:43:34 by yagoairm2        ###   ########.fr       */
+/*   Updated: 2026/10/18 15:20:06 by yagoairm2        ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minishell.h"
-#include "executor/executor.h"
-
-void		setup_signals_for_heredoc(void);
-int			create_pipe(int pipe_fd[2]);
-
 /**
- * @brief Create pipe pair
+ * @file handle_heredoc.c
+ * @brief Reading of heredoc bodies from the terminal.
  * 
- * @param pipe_fd the pipe fd
- * @param pipe_signal the pipe signal
- * 
- * @return 0 on success
+ * All the heredocs of a command line are read by a single reader process,
+ * under a single signal context: Ctrl+C in the reader cancels the whole
+ * command line, while the shell ignores it until the reader is done. Each
+ * body is sent back through one pipe as its length followed by its bytes.
  */
-static int	create_pipe_pair(int pipe_fd[2], int pipe_signal[2])
-{
-	if (create_pipe(pipe_fd) == -1)
-		return (-1);
-	if (create_pipe(pipe_signal) == -1)
-	{
-		close(pipe_fd[0]);
-		close(pipe_fd[1]);
-		return (-1);
-	}
-	return (0);
-}
 
-/**
- * @brief Exit pipe with error
- *
- * @param pipe_fd the pipe fd
- * @param pipe_signal the pipe signal
- */
-static void	exit_pipe_with_error(int pipe_fd[2], int pipe_signal[2])
-{
-	write(pipe_signal[1], "1", 1);
-	close(pipe_signal[1]);
-	close(pipe_fd[1]);
-	exit(1);
-}
+#include "minishell.h"
+#include "executor/executor.h"
+#include "executor/redir_plan.h"
+
+void	setup_signals_for_heredoc(void);
+int		create_pipe(int pipe_fd[2]);
+bool	read_all_fd(int fd, t_dynamic_buffer *buffer);
 
-/** 
- * @brief Handle signals for heredoc
+/**
+ * @brief Reads the lines of one heredoc up to its delimiter.
  * 
- * @param pipe_fd the pipe fd
- * @param pipe_signal the pipe signal
- * @param delimiter the delimiter
+ * @param delimiter The delimiter.
+ * @param body The buffer receiving the body.
+ * @return false if the reading was interrupted. The reader exits if the
+ * body cannot be allocated.
  */
-static void	handle_child_process(int pipe_fd[2],
-	int pipe_signal[2], const char *delimiter)
+static bool	read_body(const char *delimiter, t_dynamic_buffer *body)
 {
 	char	*line;
+	bool	ok;
 
-	close(pipe_signal[0]);
-	close(pipe_fd[0]);
-	setup_signals_for_heredoc();
 	while (1)
 	{
 		line = readline("> ");
+		if (!line && (g_signal_state & SIG_INT))
+			return (false);
 		if (!line)
-			exit_pipe_with_error(pipe_fd, pipe_signal);
+			return (heredoc_eof_warning(delimiter), true);
 		if (ft_strcmp(line, delimiter) == 0)
-		{
-			free(line);
-			break ;
-		}
-		write(pipe_fd[1], line, ft_strlen(line));
-		write(pipe_fd[1], "\n", 1);
+			return (free(line), true);
+		ok = append_to_buffer(body, line, ft_strlen(line))
+			&& append_char_to_buffer(body, '\n');
 		free(line);
+		if (!ok)
+			exit(EXIT_FAILURE);
 	}
-	close(pipe_fd[1]);
-	close(pipe_signal[1]);
-	exit(0);
 }
 
 /**
- * @brief Handle signals for heredoc
+ * @brief Body of the reader process.
  * 
- * @param pipe_fd the pipe fd
- * @param pipe_signal the pipe signal
- * @param pid the pid
+ * @param fd The write end of the pipe to the shell.
+ * @param ops The heredocs to read, in source order.
+ * @param count Their number.
  */
-static int	handle_parent_process(int pipe_fd[2], int pipe_signal[2], pid_t pid)
+static void	reader_process(int fd, t_redir_op **ops, size_t count)
 {
-	int		status;
-	char	buf[1];
+	t_dynamic_buffer	body;
+	size_t				i;
 
-	close(pipe_fd[1]);
-	close(pipe_signal[1]);
-	if (read(pipe_signal[0], buf, 1) > 0)
-	{
-		write(STDOUT_FILENO, "\n", 1);
-		close(pipe_fd[0]);
-		close(pipe_signal[0]);
-		waitpid(pid, &status, WNOHANG);
-		return (-1);
-	}
-	close(pipe_signal[0]);
-	waitpid(pid, &status, WNOHANG);
-	if (WIFEXITED(status) && WEXITSTATUS(status) == 1)
+	setup_signals_for_heredoc();
+	g_signal_state = SIG_NONE;
+	i = 0;
+	while (i < count)
 	{
-		close(pipe_fd[0]);
-		return (-1);
+		if (!init_buffer(&body, MIN_BUFFER_SIZE))
+			exit(EXIT_FAILURE);
+		if (!read_body(ops[i]->path, &body))
+			exit(128 + SIGINT);
+		if (!write_all(fd, (const char *)&body.size, sizeof(body.size))
+			|| !write_all(fd, body.data, body.size))
+			exit(EXIT_FAILURE);
+		free_buffer(&body);
+		i++;
 	}
-	return (pipe_fd[0]);
+	close(fd);
+	exit(EXIT_SUCCESS);
 }
 
 /**
- * @brief Handle heredoc
- *
- * @param delimiter the delimiter
+ * @brief Forks the reader and collects everything it sends.
  * 
- * @return the fd
+ * @param ops The heredocs to read.
+ * @param count Their number.
+ * @param frames The buffer receiving the bodies, as sent.
+ * @return The exit status of the reader, or -1 if it could not run.
  */
-int	handle_heredoc(const char *delimiter)
+static int	run_reader(t_redir_op **ops, size_t count, t_dynamic_buffer *frames)
 {
 	int		pipe_fd[2];
-	int		pipe_signal[2];
+	int		status;
+	bool	ok;
 	pid_t	pid;
 
-	if (create_pipe_pair(pipe_fd, pipe_signal) == -1)
+	if (create_pipe(pipe_fd) == -1)
 		return (-1);
 	pid = fork();
-	if (pid < 0)
+	if (pid == 0)
 	{
 		close(pipe_fd[0]);
-		close(pipe_fd[1]);
-		close(pipe_signal[0]);
-		close(pipe_signal[1]);
+		reader_process(pipe_fd[1], ops, count);
+	}
+	close(pipe_fd[1]);
+	ok = (pid > 0 && read_all_fd(pipe_fd[0], frames));
+	close(pipe_fd[0]);
+	if (pid < 0 || waitpid(pid, &status, 0) == -1)
 		return (-1);
+	if (!ok || !WIFEXITED(status))
+		return (EXIT_FAILURE);
+	return (WEXITSTATUS(status));
+}
+
+/**
+ * @brief Stores the bodies sent by the reader in their heredocs.
+ * 
+ * @param frames The bodies, each one as its length and its bytes.
+ * @param ops The heredocs.
+ * @param count Their number.
+ * @return false if a body is missing or could not be allocated.
+ */
+static bool	store_bodies(t_dynamic_buffer *frames, t_redir_op **ops,
+	size_t count)
+{
+	size_t	offset;
+	size_t	len;
+	size_t	i;
+
+	offset = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (frames->size - offset < sizeof(len))
+			return (false);
+		ft_memcpy(&len, frames->data + offset, sizeof(len));
+		offset += sizeof(len);
+		if (frames->size - offset < len)
+			return (false);
+		ops[i]->body = safe_malloc(len + 1);
+		if (!ops[i]->body)
+			return (false);
+		ft_memcpy(ops[i]->body, frames->data + offset, len);
+		ops[i]->body[len] = '\0';
+		offset += len;
+		i++;
 	}
-	if (pid == 0)
-		handle_child_process(pipe_fd, pipe_signal, delimiter);
-	else
-		return (handle_parent_process(pipe_fd, pipe_signal, pid));
-	return (-1);
+	return (true);
+}
+
+/**
+ * @brief Reads the bodies of heredocs from the terminal.
+ * 
+ * @param ops The heredocs, in source order.
+ * @param count Their number.
+ * @param shell The shell structure.
+ * @return true if every body was read, false otherwise (the exit status
+ * is then 130 if the user interrupted it).
+ */
+bool	read_heredoc_bodies(t_redir_op **ops, size_t count, t_shell *shell)
+{
+	t_dynamic_buffer	frames;
+	struct sigaction	ignore;
+	struct sigaction	saved;
+	int					status;
+	bool				ok;
+
+	if (!init_buffer(&frames, EXEC_BUFFER_SIZE))
+		return (false);
+	ignore.sa_handler = SIG_IGN;
+	ignore.sa_flags = 0;
+	sigemptyset(&ignore.sa_mask);
+	sigaction(SIGINT, &ignore, &saved);
+	status = run_reader(ops, count, &frames);
+	sigaction(SIGINT, &saved, NULL);
+	if (status == -1)
+		perror("minishell: heredoc");
+	if (status == 128 + SIGINT)
+		shell->exit_status = status;
+	ok = (status == 0 && store_bodies(&frames, ops, count));
+	free_buffer(&frames);
+	return (ok);
 }
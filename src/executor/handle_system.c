@@ -23,6 +23,8 @@
 
 #include "minishell.h"
 #include "executor/executor.h"
+#include "core/profile.h"
+#include "executor/redir_plan.h"
 
 int			create_pipe(int pipe_fd[2]);
 char		*find_command_in_path(const char *command, t_env *env);
@@ -35,9 +37,11 @@ void		setup_child_io(int fd_in, int is_pipe,
 				int pipe_fds[2], t_ast_node *node);
 int			handle_pipe_and_wait(t_shell *shell, pid_t pid, t_pipe_data data);
 char		*resolve_command_path(t_command command, t_shell *shell);
-char		*handle_quotes(char *arg);
+void		process_command_args(t_command *command);
 void		restore_signals(t_cmd_data cmd_data);
 void		cleanup_resources(t_command command, int fd_in);
+bool		argv_fits(t_command *command, t_shell *shell);
+int			argv_rejected(t_command command, int fd_in, int is_pipe);
 
 /**
  * @brief Handle errors during execve execution.
@@ -83,12 +87,20 @@ static void	handle_execve_error(char **envp, char **args,
  *
  * This function prints an error message indicating that the command was not
  * found and cleans up allocated resources before exiting with a status code.
+ * An empty command (e.g. an unset variable) silently exits with status 0.
  *
  * @param command The command structure containing arguments and metadata.
  * @param envp The environment variables array.
  */
 static void	command_not_found(t_command command, char **envp)
 {
+	if (!command.args[0] || command.args[0][0] == '\0')
+	{
+		free_array(envp);
+		free_array(command.args);
+		safe_free((void **)&command.name);
+		exit(0);
+	}
 	ft_putstr_fd("minishell: ", STDERR_FILENO);
 	ft_putstr_fd(command.args[0], STDERR_FILENO);
 	ft_putstr_fd(": command not found", STDERR_FILENO);
@@ -99,30 +111,6 @@ static void	command_not_found(t_command command, char **envp)
 	exit(127);
 }
 
-/**
- * @brief Processes all arguments of a command by handling quotes.
- *        Replaces original args if processed result is valid.
- * 
- * @param command The command whose args will be processed.
- */
-void	process_command_args(t_command *command)
-{
-	int		i;
-	char	*processed_arg;
-
-	i = 0;
-	while (command->args[i] != NULL)
-	{
-		processed_arg = handle_quotes(command->args[i]);
-		if (processed_arg)
-		{
-			safe_free((void **)&command->args[i]);
-			command->args[i] = processed_arg;
-		}
-		i++;
-	}
-}
-
 /**
  * @brief Execute a system command.
  *
@@ -132,38 +120,74 @@ void	process_command_args(t_command *command)
  *
  * @param command The command structure containing arguments and metadata.
  * @param shell The shell structure containing environment and state.
+ * @param spawn The prof_start() timestamp taken before fork().
  */
-static void	execute_sys_command(t_command command, t_shell *shell)
+static void	execute_sys_command(t_command command, t_shell *shell,
+				uint64_t spawn)
 {
-	char	**envp;
-	char	*cmd_path;
+	char		**envp;
+	char		*cmd_path;
+	uint64_t	start;
 
+	start = prof_start();
 	envp = env_to_array(shell->env);
+	prof_stop(PROF_ENV_ARRAY, start);
 	if (!envp)
 	{
 		perror("env allocation failed");
 		exit(EXIT_FAILURE);
 	}
-	process_command_args(&command);
+	start = prof_start();
 	cmd_path = resolve_command_path(command, shell);
-	if (!cmd_path && (!command.args[0] || command.args[0][0] == '\0'))
-	{
-		free_array(envp);
-		free_array(command.args);
-		safe_free((void **)&command.name);
-		exit(0);
-	}
+	prof_stop(PROF_RESOLVE_PATH, start);
 	if (!cmd_path)
 		command_not_found(command, envp);
+	prof_stop(PROF_SPAWN, spawn);
 	execve(cmd_path, command.args, envp);
 	handle_execve_error(envp, command.args, &cmd_path, command.name);
 }
 
+/**
+ * @brief Fork the child process that executes a system command.
+ *
+ * The child restores the default signal handlers, sets up its standard
+ * input and output, applies the redirection plan of the command and execs
+ * it. The parent registers the child for the `time` keyword and the
+ * profiler.
+ *
+ * @param cmd_data The command data (command, pipe and process id).
+ * @param node The AST node representing the command to execute.
+ * @param shell The shell structure containing environment and state.
+ * @return The process id of the child, or -1 on failure.
+ */
+static pid_t	spawn_child(t_cmd_data *cmd_data, t_ast_node *node,
+					t_shell *shell)
+{
+	cmd_data->spawn = prof_start();
+	cmd_data->pid = create_child_process();
+	if (cmd_data->pid == 0)
+	{
+		signal(SIGINT, SIG_DFL);
+		signal(SIGQUIT, SIG_DFL);
+		setup_child_io(cmd_data->data.fd_in, cmd_data->data.is_pipe,
+			cmd_data->data.pipe_fds, node);
+		if (redir_plan_apply(node->redir_plan) == -1)
+			exit(EXIT_FAILURE);
+		execute_sys_command(cmd_data->command, shell, cmd_data->spawn);
+	}
+	if (cmd_data->pid > 0)
+		register_child(shell, cmd_data->pid, cmd_data->command.name,
+			cmd_data->spawn);
+	return (cmd_data->pid);
+}
+
 /**
  * @brief Handle the execution of a system command.
  *
  * This function manages the execution of a system command, including
  * setting up pipes, creating child processes, and cleaning up resources.
+ * The quotes of the arguments are removed before forking, so that their
+ * size can be checked against ARG_MAX.
  *
  * @param node The AST node representing the command to execute.
  * @param shell The shell structure containing environment and state.
@@ -176,23 +200,22 @@ int	handle_system_cmd(t_ast_node *node, t_shell *shell, int fd_in, int is_pipe)
 {
 	t_cmd_data	cmd_data;
 
+	cmd_data.spawn = prof_start();
 	cmd_data.command = generate_full_command(node);
+	process_command_args(&cmd_data.command);
+	prof_stop(PROF_GEN_COMMAND, cmd_data.spawn);
+	if (!argv_fits(&cmd_data.command, shell))
+		return (argv_rejected(cmd_data.command, fd_in, is_pipe));
 	cmd_data.data.fd_in = fd_in;
 	cmd_data.data.is_pipe = is_pipe;
+	cmd_data.data.pipe_fds[0] = -1;
+	cmd_data.data.pipe_fds[1] = -1;
 	if (is_pipe && create_pipe(cmd_data.data.pipe_fds) == -1)
 		return (STDIN_FILENO);
 	cmd_data.old_sigint = signal(SIGINT, SIG_IGN);
 	cmd_data.old_sigquit = signal(SIGQUIT, SIG_IGN);
-	cmd_data.pid = create_child_process();
-	if (cmd_data.pid == -1)
+	if (spawn_child(&cmd_data, node, shell) == -1)
 		return (restore_signals(cmd_data), STDIN_FILENO);
-	if (cmd_data.pid == 0)
-	{
-		signal(SIGINT, SIG_DFL);
-		signal(SIGQUIT, SIG_DFL);
-		setup_child_io(fd_in, is_pipe, cmd_data.data.pipe_fds, node);
-		execute_sys_command(cmd_data.command, shell);
-	}
 	cmd_data.ret = handle_pipe_and_wait(shell, cmd_data.pid, cmd_data.data);
 	restore_signals(cmd_data);
 	return (cleanup_resources(cmd_data.command, fd_in), cmd_data.ret);
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_buffer.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:05:12 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:05:12 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file heredoc_buffer.c
+ * @brief Heredoc and here-string bodies served from memory.
+ * 
+ * When the body of a heredoc is already known (a here-string, or a heredoc
+ * read from a script), the shell writes it itself instead of forking a
+ * reader. A body that fits in the pipe buffer goes through a pipe, since
+ * the write cannot block without a reader; a larger one goes to an
+ * anonymous memory file (memfd), or to an unlinked temporary file where
+ * memfd is not available, rewound before the command reads it.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+#include <errno.h>
+
+int	create_pipe(int pipe_fd[2]);
+
+#ifdef __linux__
+
+/**
+ * @brief Creates an anonymous memory file.
+ * 
+ * @return The descriptor, or -1 if memfd is not supported.
+ */
+static int	open_memfd(void)
+{
+	return (memfd_create("minishell-heredoc", MFD_CLOEXEC));
+}
+#else
+
+static int	open_memfd(void)
+{
+	errno = ENOSYS;
+	return (-1);
+}
+#endif
+
+/**
+ * @brief Writes a whole buffer to a descriptor.
+ * 
+ * @param fd The descriptor.
+ * @param data The buffer.
+ * @param len The number of bytes to write.
+ * @return true on success.
+ */
+bool	write_all(int fd, const char *data, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, data, len);
+		if (written == -1 && errno == EINTR)
+			continue ;
+		if (written <= 0)
+			return (false);
+		data += written;
+		len -= written;
+	}
+	return (true);
+}
+
+/**
+ * @brief Stores a large body in a memfd or an unlinked temporary file.
+ * 
+ * @param data The body.
+ * @param len Its length.
+ * @return A descriptor positioned at the start of the body, or -1.
+ */
+static int	open_file_input(const char *data, size_t len)
+{
+	char	path[32];
+	int		fd;
+
+	fd = open_memfd();
+	if (fd == -1)
+	{
+		ft_memcpy(path, HEREDOC_TMP_TEMPLATE, sizeof(HEREDOC_TMP_TEMPLATE));
+		fd = mkstemp(path);
+		if (fd != -1)
+			unlink(path);
+		if (fd != -1)
+			fcntl(fd, F_SETFD, FD_CLOEXEC);
+	}
+	if (fd == -1)
+		return (-1);
+	if (!write_all(fd, data, len) || lseek(fd, 0, SEEK_SET) == -1)
+		return (close(fd), -1);
+	return (fd);
+}
+
+/**
+ * @brief Returns a descriptor from which a command reads a known body.
+ * 
+ * @param data The body.
+ * @param len Its length.
+ * @return The read end of a pipe or a rewound file, or -1 on error (the
+ * error is reported).
+ */
+int	open_buffered_input(const char *data, size_t len)
+{
+	int	pipe_fd[2];
+	int	fd;
+
+	if (len > HEREDOC_PIPE_MAX)
+		fd = open_file_input(data, len);
+	else if (create_pipe(pipe_fd) == -1)
+		fd = -1;
+	else
+	{
+		fd = pipe_fd[0];
+		if (!write_all(pipe_fd[1], data, len))
+		{
+			close(fd);
+			fd = -1;
+		}
+		close(pipe_fd[1]);
+	}
+	if (fd == -1)
+		perror("minishell: heredoc");
+	return (fd);
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_collect.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:02:48 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:02:48 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file heredoc_collect.c
+ * @brief Collection of every heredoc body before a command line runs.
+ * 
+ * The AST is walked once, in source order, before anything is launched:
+ * the redirection plan of each command is compiled and the body of each
+ * of its heredocs is stored in the plan. Bodies already read from a script
+ * are used first; the others are read from the terminal by a single reader
+ * process. Launching a stage then only writes a known body, so no stage
+ * waits on a prompt while the pipeline is half started.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+
+/**
+ * @brief Adds the heredocs of a command whose body is still unknown.
+ * 
+ * @param chain The outermost redirection node of the command.
+ * @param cmd The command node, which receives the compiled plan.
+ * @param ops The array to fill, or NULL to only count.
+ * @param count The number of heredocs found so far.
+ * @return The new number of heredocs found.
+ */
+static size_t	add_command_heredocs(t_ast_node *chain, t_ast_node *cmd,
+	t_redir_op **ops, size_t count)
+{
+	t_redir_plan	*plan;
+	int				i;
+
+	if (!cmd->redir_plan)
+		cmd->redir_plan = compile_redir_plan(chain);
+	plan = cmd->redir_plan;
+	i = 0;
+	while (plan && i < plan->count)
+	{
+		if (plan->ops[i].heredoc && !plan->ops[i].body)
+		{
+			if (ops)
+				ops[count] = &plan->ops[i];
+			count++;
+		}
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Walks a node in source order and gathers its heredocs.
+ * 
+ * A redirection chain ending with a pipe is executed as the pipe, as in
+ * handle_redirection_node.
+ * 
+ * @param node The node.
+ * @param ops The array to fill, or NULL to only count.
+ * @param count The number of heredocs found so far.
+ * @return The new number of heredocs found.
+ */
+static size_t	walk_heredocs(t_ast_node *node, t_redir_op **ops, size_t count)
+{
+	t_ast_node	*end;
+
+	end = node;
+	while (end && end->type == NODE_REDIRECTION)
+		end = end->data.redirection.child;
+	if (!end)
+		return (count);
+	if (end->type == NODE_PIPE)
+	{
+		count = walk_heredocs(end->data.pipe.left, ops, count);
+		return (walk_heredocs(end->data.pipe.right, ops, count));
+	}
+	if (end->type == NODE_COMMAND && end != node)
+		return (add_command_heredocs(node, end, ops, count));
+	return (count);
+}
+
+/**
+ * @brief Gathers the heredocs of every node of the top-level list.
+ * 
+ * @param root The root of the AST.
+ * @param ops The array to fill, or NULL to only count.
+ * @return The number of heredocs whose body is unknown.
+ */
+static size_t	gather_heredocs(t_ast_node *root, t_redir_op **ops)
+{
+	size_t	count;
+
+	count = 0;
+	while (root)
+	{
+		count = walk_heredocs(root, ops, count);
+		root = root->next;
+	}
+	return (count);
+}
+
+/**
+ * @brief Gives the heredocs the bodies already read from a script.
+ * 
+ * @param ops The heredocs, in source order.
+ * @param count Their number.
+ * @param shell The shell structure.
+ * @return The number of heredocs that got a body.
+ */
+static size_t	use_script_bodies(t_redir_op **ops, size_t count,
+	t_shell *shell)
+{
+	size_t	i;
+	char	*body;
+
+	i = 0;
+	while (i < count && shell->heredoc_bodies
+		&& shell->heredoc_bodies[shell->heredoc_next])
+	{
+		body = shell->heredoc_bodies[shell->heredoc_next++];
+		ops[i]->body = ft_strdup(body);
+		if (!ops[i]->body)
+			break ;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Stores the body of every heredoc of a command line in its plan.
+ * 
+ * @param root The root of the AST.
+ * @param shell The shell structure.
+ * @return true if the command line can run, false if a heredoc was
+ * interrupted (the exit status is then 130) or could not be read.
+ */
+bool	collect_heredocs(t_ast_node *root, t_shell *shell)
+{
+	t_redir_op	**ops;
+	size_t		count;
+	size_t		done;
+	bool		ok;
+
+	count = gather_heredocs(root, NULL);
+	if (count == 0)
+		return (true);
+	ops = safe_malloc(count * sizeof(t_redir_op *));
+	if (!ops)
+		return (false);
+	gather_heredocs(root, ops);
+	done = use_script_bodies(ops, count, shell);
+	ok = (done == count || read_heredoc_bodies(ops + done, count - done,
+				shell));
+	free(ops);
+	return (ok);
+}
@@ -25,6 +25,7 @@
 bool	init_more_process(t_more_data *data);
 bool	send_data_to_more(int fd, char *buffer,
 			size_t size, t_more_data *data);
+void	print_fd(int fd);
 
 /**
  * @brief More execution.
@@ -51,6 +52,28 @@ bool	more_execution(int fd, char *buffer, size_t buffer_size)
 	return (send_data_to_more(fd, buffer, buffer_size, &data));
 }
 
+/**
+ * @brief Prints the output of a command line and closes it.
+ *
+ * The output goes through more when it is the last command.
+ *
+ * @param fd The output of the command line, or -1 if it has none.
+ * @param is_more Whether the last command is more.
+ */
+void	flush_output_fd(int fd, bool is_more)
+{
+	char	buffer[EXEC_BUFFER_SIZE];
+
+	if (fd == -1)
+		return ;
+	if (is_more)
+		more_execution(fd, buffer, sizeof(buffer));
+	else
+		print_fd(fd);
+	if (fd > STDERR_FILENO)
+		close(fd);
+}
+
 /**
  * @brief Find command node inside redirection chain
  *
@@ -63,7 +63,7 @@ bool	send_data_to_more(int fd, char *buffer,
  */
 bool	init_more_process(t_more_data *data)
 {
-	if (pipe(data->pipe_fd) != 0)
+	if (create_pipe(data->pipe_fd) != 0)
 		return (false);
 	data->pid = fork();
 	if (data->pid == 0)
@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:52 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:31:52 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file procsub.c
+ * @brief Launch of process substitutions.
+ * 
+ * The list of a `<(list)` or `>(list)` word is tokenized and expanded like
+ * a command line of its own, then parsed into a subshell node. A child
+ * runs the node with its standard output (for `<(`) or standard input (for
+ * `>(`) on a pipe, concurrently with the command that uses the word.
+ */
+
+#include "minishell.h"
+#include "executor/procsub.h"
+
+void			free_ast_node(t_ast_node **node);
+char			*ft_strndup(const char *s, size_t n);
+t_syntax_error	validate_input(char *input);
+
+/**
+ * @brief Runs a subshell node in a forked child, on one end of a pipe.
+ * 
+ * The ends of the pipes of the process substitutions of the parent are
+ * closed first, so that they do not keep their readers from seeing EOF.
+ * 
+ * @param subshell The subshell node to run.
+ * @param fds The pipe.
+ * @param target STDIN_FILENO to read from the pipe, STDOUT_FILENO to write
+ * to it.
+ * @param shell The shell structure.
+ */
+void	run_subshell(t_ast_node *subshell, int fds[2], int target,
+			t_shell *shell)
+{
+	t_procsub	own;
+	t_ast		ast;
+
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	if (target == STDIN_FILENO)
+		dup2(fds[0], STDIN_FILENO);
+	else
+		dup2(fds[1], STDOUT_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	procsub_close(shell);
+	own.count = 0;
+	own.closed = 0;
+	shell->procsub = &own;
+	shell->timing = NULL;
+	shell->heredoc_bodies = NULL;
+	ast.root = subshell->data.subshell.child;
+	ast.syntax_error = SYNTAX_OK;
+	if (collect_heredocs(ast.root, shell))
+		execute_ast(&ast, shell);
+	procsub_reap(shell);
+	free_ast_node(&subshell);
+	exit(shell->exit_status);
+}
+
+/**
+ * @brief Parses the list of a substitution into a subshell node.
+ * 
+ * The list is validated, tokenized and expanded like a command line,
+ * with subst_depth raised while it is.
+ * 
+ * @param list The start of the list.
+ * @param len The length of the list.
+ * @param shell The shell structure.
+ * @return The subshell node, or NULL if the list is empty or invalid.
+ */
+t_ast_node	*parse_subshell(const char *list, size_t len, t_shell *shell)
+{
+	char			*line;
+	char			**tokens;
+	t_ast_node		*group;
+	int				count;
+	t_syntax_error	error;
+
+	line = ft_strndup(list, len);
+	tokens = NULL;
+	error = validate_input(line);
+	shell->subst_depth++;
+	if (error == SYNTAX_OK)
+		tokens = tokenize_input(line, shell);
+	else if (error != SYNTAX_EMPTY)
+		handle_error(error, shell, NULL);
+	shell->subst_depth--;
+	safe_free((void **)&line);
+	if (!tokens)
+		return (NULL);
+	count = 0;
+	while (tokens[count])
+		count++;
+	group = parse_command_group(tokens, count, shell->env);
+	free_tokens_array(tokens, count);
+	return (create_subshell_node(group));
+}
+
+/**
+ * @brief Starts a process substitution.
+ * 
+ * The shell keeps the read end of the pipe for `<(list)` and the write end
+ * for `>(list)`, without close-on-exec so that the command inherits it.
+ * 
+ * @param word The `<(list)` or `>(list)` word.
+ * @param shell The shell structure.
+ * @return The `/dev/fd/N` path of the shell's end, or NULL on failure.
+ */
+static char	*start_procsub(const char *word, t_shell *shell)
+{
+	t_procsub	*ps;
+	t_ast_node	*subshell;
+	int			fds[2];
+	int			keep;
+
+	ps = shell->procsub;
+	if (!ps || ps->count >= PROCSUB_MAX)
+		return (NULL);
+	subshell = parse_subshell(word + 2, ft_strlen(word) - 3, shell);
+	if (!subshell || create_pipe(fds) == -1)
+		return (free_ast_node(&subshell), NULL);
+	ps->pids[ps->count] = create_child_process();
+	if (ps->pids[ps->count] == 0 && word[0] == '<')
+		run_subshell(subshell, fds, STDOUT_FILENO, shell);
+	else if (ps->pids[ps->count] == 0)
+		run_subshell(subshell, fds, STDIN_FILENO, shell);
+	free_ast_node(&subshell);
+	keep = fds[word[0] == '>'];
+	close(fds[word[0] == '<']);
+	if (ps->pids[ps->count] == -1)
+		return (close(keep), NULL);
+	shell->last_bg = ps->pids[ps->count];
+	fcntl(keep, F_SETFD, 0);
+	ps->fds[ps->count++] = keep;
+	return (procsub_path(keep));
+}
+
+/**
+ * @brief Replaces a process substitution word by its `/dev/fd/N` path.
+ * 
+ * @param word The word, left as is when it is not a process substitution.
+ * @param shell The shell structure.
+ * @return False if the substitution could not be started.
+ */
+static bool	expand_word(char **word, t_shell *shell)
+{
+	char	*path;
+
+	if (!is_procsub_word(*word))
+		return (true);
+	path = start_procsub(*word, shell);
+	if (!path)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		ft_putstr_fd(*word, STDERR_FILENO);
+		ft_putstr_fd(": bad process substitution\n", STDERR_FILENO);
+		shell->exit_status = 1;
+		return (false);
+	}
+	safe_free((void **)word);
+	*word = path;
+	return (true);
+}
+
+/**
+ * @brief Starts the process substitutions among the words of a command.
+ * 
+ * @param words The NULL-terminated arguments of the command.
+ * @param shell The shell structure.
+ * @return False if one could not be started (the command must not run).
+ */
+bool	procsub_expand(char **words, t_shell *shell)
+{
+	size_t	i;
+
+	i = 0;
+	while (words && words[i])
+	{
+		if (!expand_word(&words[i], shell))
+			return (false);
+		i++;
+	}
+	return (true);
+}
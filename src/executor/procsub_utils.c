@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:44:08 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:44:08 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file procsub_utils.c
+ * @brief Bookkeeping of the process substitutions of a command line.
+ */
+
+#include "minishell.h"
+#include "executor/procsub.h"
+
+char	*ft_strjoin(const char *s1, const char *s2);
+
+/**
+ * @brief Starts the process substitutions used as redirection targets.
+ * 
+ * @param plan The compiled redirections of the command.
+ * @param shell The shell structure.
+ * @return False if one could not be started (the command must not run).
+ */
+bool	procsub_expand_plan(t_redir_plan *plan, t_shell *shell)
+{
+	char	*words[2];
+	int		i;
+
+	i = 0;
+	while (i < plan->count)
+	{
+		if (plan->ops[i].kind == REDIR_OP_OPEN && plan->ops[i].path)
+		{
+			words[0] = plan->ops[i].path;
+			words[1] = NULL;
+			if (!procsub_expand(words, shell))
+				return (false);
+			plan->ops[i].path = words[0];
+		}
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Builds the `/dev/fd/N` path of a descriptor.
+ * 
+ * @param fd The descriptor.
+ * @return The allocated path, or NULL on allocation failure.
+ */
+char	*procsub_path(int fd)
+{
+	char	*num;
+	char	*path;
+
+	num = ft_itoa(fd);
+	if (!num)
+		return (NULL);
+	path = ft_strjoin("/dev/fd/", num);
+	safe_free((void **)&num);
+	return (path);
+}
+
+/**
+ * @brief Closes the shell's ends of the pipes of the substitutions.
+ * 
+ * Called once the command that uses them has been launched: it holds its
+ * own copies, and a substitution reading from the shell only sees EOF when
+ * every write end is closed.
+ * 
+ * @param shell The shell structure.
+ */
+void	procsub_close(t_shell *shell)
+{
+	t_procsub	*ps;
+
+	ps = shell->procsub;
+	if (!ps)
+		return ;
+	while (ps->closed < ps->count)
+		close(ps->fds[ps->closed++]);
+}
+
+/**
+ * @brief Waits for the process substitutions of the command line.
+ * 
+ * Their exit status is not the one of the command line.
+ * 
+ * @param shell The shell structure.
+ */
+void	procsub_reap(t_shell *shell)
+{
+	t_procsub	*ps;
+	size_t		i;
+	int			status;
+
+	ps = shell->procsub;
+	if (!ps)
+		return ;
+	procsub_close(shell);
+	i = 0;
+	while (i < ps->count)
+	{
+		if (ps->pids[i] > 0)
+			shell_wait(shell, ps->pids[i], &status, 0);
+		i++;
+	}
+	ps->count = 0;
+	ps->closed = 0;
+}
+
+/**
+ * @brief Records that a wait for any child reaped a process substitution.
+ * 
+ * @param shell The shell structure.
+ * @param pid The reaped process.
+ * @return true if pid is a process substitution, whose status must then be
+ * ignored.
+ */
+bool	procsub_reaped(t_shell *shell, pid_t pid)
+{
+	size_t	i;
+
+	if (!shell->procsub)
+		return (false);
+	i = 0;
+	while (i < shell->procsub->count)
+	{
+		if (shell->procsub->pids[i] == pid)
+		{
+			shell->procsub->pids[i] = 0;
+			return (true);
+		}
+		i++;
+	}
+	return (false);
+}
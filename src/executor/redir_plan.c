@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan.c
+ * @brief Compilation of a redirection chain into a redirection plan.
+ * 
+ * The parser builds one redirection node per redirection, in source order,
+ * with the command at the end of the chain. Each node becomes one operation
+ * of the plan, with its file name already unquoted, so executing the command
+ * again does not walk or clean the chain again.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+
+bool	compile_redir_op(t_ast_node *redir, t_redir_op *op);
+
+/**
+ * @brief Counts the redirection nodes of a chain.
+ * 
+ * @param node The outermost redirection node.
+ * @return The number of redirections before the command.
+ */
+static int	count_redirections(t_ast_node *node)
+{
+	int	count;
+
+	count = 0;
+	while (node && node->type == NODE_REDIRECTION)
+	{
+		count++;
+		node = node->data.redirection.child;
+	}
+	return (count);
+}
+
+/**
+ * @brief Compiles the redirection chain starting at node.
+ * 
+ * @param node The outermost redirection node of a command.
+ * @return The plan, or NULL on allocation failure.
+ */
+t_redir_plan	*compile_redir_plan(t_ast_node *node)
+{
+	t_redir_plan	*plan;
+	t_ast_node		*current;
+	int				count;
+
+	count = count_redirections(node);
+	plan = safe_malloc(sizeof(t_redir_plan));
+	if (!plan)
+		return (NULL);
+	plan->count = 0;
+	plan->failed = false;
+	plan->ops = safe_malloc(sizeof(t_redir_op) * (count + 1));
+	plan->saved = safe_malloc(sizeof(int) * (count + 1));
+	if (!plan->ops || !plan->saved)
+		return (free_redir_plan(&plan), NULL);
+	current = node;
+	while (plan->count < count)
+	{
+		if (!compile_redir_op(current, &plan->ops[plan->count]))
+			return (free_redir_plan(&plan), NULL);
+		plan->count++;
+		current = current->data.redirection.child;
+	}
+	return (plan);
+}
+
+/**
+ * @brief Frees a redirection plan and sets the pointer to NULL.
+ * 
+ * @param plan The plan to free.
+ */
+void	free_redir_plan(t_redir_plan **plan)
+{
+	int	i;
+
+	if (!plan || !*plan)
+		return ;
+	i = 0;
+	while (i < (*plan)->count)
+	{
+		free((*plan)->ops[i].path);
+		free((*plan)->ops[i].body);
+		free((*plan)->ops[i].tmp);
+		i++;
+	}
+	free((*plan)->ops);
+	free((*plan)->saved);
+	free(*plan);
+	*plan = NULL;
+}
+
+/**
+ * @brief Checks whether the plan redirects a file descriptor.
+ * 
+ * @param plan The plan.
+ * @param fd The file descriptor.
+ * @return true if an operation of the plan targets fd.
+ */
+bool	redir_plan_targets(t_redir_plan *plan, int fd)
+{
+	int	i;
+
+	i = 0;
+	while (plan && i < plan->count)
+	{
+		if (plan->ops[i].fd == fd)
+			return (true);
+		i++;
+	}
+	return (false);
+}
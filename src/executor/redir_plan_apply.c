@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_apply.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan_apply.c
+ * @brief Application of a redirection plan to the current process.
+ * 
+ * A forked child applies the plan after its pipe ends are in place and
+ * right before execve, with the files already opened by the shell.
+ * Builtins run in the shell itself, so the plan is applied with every
+ * replaced descriptor saved, and restored afterwards.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+#include <errno.h>
+#include <string.h>
+
+/**
+ * @brief Prints the error of a failed operation.
+ * 
+ * An open only fails with EEXIST when noclobber refused to overwrite.
+ * 
+ * @param op The operation that failed.
+ */
+void	redir_op_error(t_redir_op *op)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(op->path, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	if (errno == EEXIST && op->kind == REDIR_OP_OPEN)
+		ft_putstr_fd("cannot overwrite existing file", STDERR_FILENO);
+	else
+		ft_putstr_fd(strerror(errno), STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Applies one operation of a plan.
+ * 
+ * Opened files and heredoc bodies are moved onto their target and the
+ * original descriptor is closed. A file the shell did not open beforehand
+ * is opened here. Files are opened close-on-exec, so the flag is cleared
+ * when one lands on its target directly. A dup of a descriptor that is
+ * not open fails with EBADF.
+ * 
+ * @param op The operation.
+ * @return -1 on failure with errno set, another value on success.
+ */
+static int	apply_op(t_redir_op *op)
+{
+	int	fd;
+	int	result;
+
+	if (op->kind == REDIR_OP_CLOSE)
+		return (close(op->fd), 0);
+	fd = op->src_fd;
+	if (op->kind == REDIR_OP_OPEN && fd == -1)
+		fd = open(op->path, op->flags | O_CLOEXEC, 0644);
+	else if (fd == -1)
+		errno = EBADF;
+	if (fd == -1)
+		return (-1);
+	if (fd == op->fd)
+		return (fcntl(fd, F_SETFD, 0));
+	result = dup2(fd, op->fd);
+	if (op->kind == REDIR_OP_OPEN || op->heredoc)
+	{
+		close(fd);
+		op->src_fd = -1;
+	}
+	return (result);
+}
+
+/**
+ * @brief Applies a whole plan, in order.
+ * 
+ * Used by forked children: nothing is saved since the process is about to
+ * exec. The first failing operation is reported and stops the plan.
+ * 
+ * @param plan The plan.
+ * @return 0 on success, -1 on failure.
+ */
+int	redir_plan_apply(t_redir_plan *plan)
+{
+	int	i;
+
+	i = 0;
+	while (plan && i < plan->count)
+	{
+		if (apply_op(&plan->ops[i]) == -1)
+			return (redir_op_error(&plan->ops[i]), -1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Applies a plan to the shell, saving every replaced descriptor.
+ * 
+ * The saved copies are placed at or above REDIR_SAVE_FD_MIN with the
+ * close-on-exec flag, so later operations of the plan cannot clobber them
+ * and commands forked meanwhile do not inherit them. On failure the
+ * operations already applied are undone.
+ * 
+ * @param plan The plan.
+ * @return 0 on success, -1 on failure.
+ */
+int	redir_plan_apply_saved(t_redir_plan *plan)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->count)
+	{
+		plan->saved[i] = fcntl(plan->ops[i].fd, F_DUPFD_CLOEXEC,
+				REDIR_SAVE_FD_MIN);
+		if (apply_op(&plan->ops[i]) == -1)
+		{
+			redir_op_error(&plan->ops[i]);
+			redir_plan_restore(plan, i + 1);
+			return (-1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Undoes the first applied operations of a plan, last first.
+ * 
+ * A descriptor that was closed before its operation is closed again.
+ * 
+ * @param plan The plan.
+ * @param applied The number of operations that were applied.
+ */
+void	redir_plan_restore(t_redir_plan *plan, int applied)
+{
+	while (applied > 0)
+	{
+		applied--;
+		if (plan->saved[applied] == -1)
+			close(plan->ops[applied].fd);
+		else
+		{
+			dup2(plan->saved[applied], plan->ops[applied].fd);
+			close(plan->saved[applied]);
+		}
+		plan->saved[applied] = -1;
+	}
+}
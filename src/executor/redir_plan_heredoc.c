@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_heredoc.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+
+/**
+ * @brief Opens the body of every heredoc and here-string of a plan.
+ * 
+ * Runs in the shell right before the command is launched, so the child
+ * only has to dup the resulting descriptor. The bodies were collected by
+ * collect_heredocs; if one cannot be opened, every descriptor the plan
+ * already opened is closed.
+ * 
+ * @param plan The plan.
+ * @return true on success, false if a body is missing or cannot be opened.
+ */
+bool	redir_plan_open_heredocs(t_redir_plan *plan)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->count)
+	{
+		if (plan->ops[i].heredoc)
+		{
+			if (plan->ops[i].body)
+				plan->ops[i].src_fd = open_buffered_input(plan->ops[i].body,
+						ft_strlen(plan->ops[i].body));
+			if (plan->ops[i].src_fd == -1)
+				return (redir_plan_close(plan), false);
+		}
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Warns that a heredoc ended without its delimiter.
+ * 
+ * @param delimiter The delimiter that was expected.
+ */
+void	heredoc_eof_warning(const char *delimiter)
+{
+	ft_putstr_fd("minishell: warning: here-document delimited by "
+		"end-of-file (wanted `", STDERR_FILENO);
+	ft_putstr_fd(delimiter, STDERR_FILENO);
+	ft_putstr_fd("')\n", STDERR_FILENO);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_op.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:14:07 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 12:14:07 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan_op.c
+ * @brief Compilation of one redirection node into a plan operation.
+ * 
+ * `N>`, `N>>` and `N<` open a file onto descriptor N, `N<<` and `N<<<` dup
+ * a heredoc or a here-string onto it, `N>&M` and `N<&M` dup descriptor M
+ * onto N and `N>&-` closes N. `N>|` and `N>^` open like `N>`; the shell
+ * tells them apart by the type of the operation when it opens the file.
+ * Without a number, input operators apply to 0 and output operators to 1.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+
+/**
+ * @brief Returns the descriptor a redirection applies to.
+ * 
+ * @param redir The redirection node.
+ * @return The descriptor written before the operator, or its default.
+ */
+static int	redirection_target(t_ast_node *redir)
+{
+	t_redir_type	type;
+
+	if (redir->data.redirection.fd != -1)
+		return (redir->data.redirection.fd);
+	type = redir->data.redirection.type;
+	if (type == REDIR_INPUT || type == REDIR_HEREDOC
+		|| type == REDIR_HERESTRING || type == REDIR_DUP_IN)
+		return (STDIN_FILENO);
+	return (STDOUT_FILENO);
+}
+
+/**
+ * @brief Compiles a `>&` or `<&` redirection.
+ * 
+ * The word is `-` to close the descriptor or the number of the descriptor
+ * to duplicate. Any other word is kept as an invalid source, so applying
+ * the plan reports it as a bad file descriptor.
+ * 
+ * @param op The operation to fill (path already set).
+ */
+static void	compile_dup_op(t_redir_op *op)
+{
+	op->kind = REDIR_OP_DUP;
+	if (ft_strcmp(op->path, "-") == 0)
+		op->kind = REDIR_OP_CLOSE;
+	else if (is_fd_prefix(op->path, ft_strlen(op->path)))
+		op->src_fd = get_redirection_fd(op->path);
+}
+
+/**
+ * @brief Builds the body of a here-string: its word and a newline.
+ * 
+ * @param op The operation to fill (path already set to the word).
+ */
+static void	compile_herestring_op(t_redir_op *op)
+{
+	size_t	len;
+
+	len = ft_strlen(op->path);
+	op->body = safe_malloc(len + 2);
+	if (!op->body)
+		return ;
+	ft_memcpy(op->body, op->path, len);
+	op->body[len] = '\n';
+	op->body[len + 1] = '\0';
+}
+
+/**
+ * @brief Returns the path of a redirection, with its quotes removed.
+ * 
+ * A process substitution is kept as written: it is started, and replaced
+ * by its `/dev/fd/N` path, when the command is launched.
+ * 
+ * @param redir The redirection node.
+ * @return The allocated path, or NULL on allocation failure.
+ */
+static char	*compile_path(t_ast_node *redir)
+{
+	t_redir_type	type;
+
+	type = redir->data.redirection.type;
+	if (type != REDIR_HEREDOC && type != REDIR_HERESTRING
+		&& is_procsub_word(redir->data.redirection.file))
+		return (ft_strdup(redir->data.redirection.file));
+	return (handle_quotes(redir->data.redirection.file));
+}
+
+/**
+ * @brief Compiles one redirection node into a plan operation.
+ * 
+ * @param redir The redirection node.
+ * @param op The operation to fill.
+ * @return true on success, false if the path or the body could not be
+ * allocated.
+ */
+bool	compile_redir_op(t_ast_node *redir, t_redir_op *op)
+{
+	t_redir_type	type;
+
+	type = redir->data.redirection.type;
+	ft_memset(op, 0, sizeof(t_redir_op));
+	op->type = type;
+	op->fd = redirection_target(redir);
+	op->flags = O_WRONLY | O_CREAT | O_TRUNC;
+	op->src_fd = -1;
+	op->heredoc = (type == REDIR_HEREDOC || type == REDIR_HERESTRING);
+	if (type == REDIR_APPEND)
+		op->flags = O_WRONLY | O_CREAT | O_APPEND;
+	else if (type == REDIR_INPUT)
+		op->flags = O_RDONLY;
+	op->path = compile_path(redir);
+	if (!op->path)
+		return (false);
+	if (op->heredoc)
+		op->kind = REDIR_OP_DUP;
+	if (type == REDIR_HERESTRING)
+		compile_herestring_op(op);
+	else if (type == REDIR_DUP_IN || type == REDIR_DUP_OUT)
+		compile_dup_op(op);
+	if (type == REDIR_HERESTRING && !op->body)
+		return (free(op->path), false);
+	return (true);
+}
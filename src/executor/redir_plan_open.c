@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_open.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan_open.c
+ * @brief Opening of the redirection targets of a plan before the launch.
+ * 
+ * The files of a plan are opened by the shell, in source order, before the
+ * command is forked. The first target that cannot be opened, or duplicated,
+ * is reported and stops the command, so the redirections before it still
+ * create their files as in bash, and nothing is forked for it. The child
+ * then only has to dup the descriptors onto their targets.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+#include <errno.h>
+
+/**
+ * @brief Checks that the source of a `N>&M` operation will be open.
+ * 
+ * M is open when an earlier operation of the plan targets it, or when it
+ * is open in the shell, which the child inherits.
+ * 
+ * @param plan The plan.
+ * @param i The index of the dup operation.
+ * @return true if the source is open, false with errno set to EBADF.
+ */
+static bool	dup_source_open(t_redir_plan *plan, int i)
+{
+	int	src;
+
+	src = plan->ops[i].src_fd;
+	errno = EBADF;
+	if (src == -1)
+		return (false);
+	while (i > 0)
+	{
+		i--;
+		if (plan->ops[i].fd == src)
+			return (plan->ops[i].kind != REDIR_OP_CLOSE);
+	}
+	return (fcntl(src, F_GETFD) != -1);
+}
+
+/**
+ * @brief Opens the file of an operation away from the low descriptors.
+ * 
+ * With noclobber, `>` does not overwrite an existing regular file, and
+ * `>^` opens a temporary file next to its target. The file is moved at or
+ * above REDIR_SAVE_FD_MIN, so that applying an earlier operation of the
+ * plan to a low descriptor cannot replace it.
+ * 
+ * @param op The open operation.
+ * @param shell The shell, for its options.
+ * @return The close-on-exec descriptor, or -1 with errno set.
+ */
+static int	open_target(t_redir_op *op, t_shell *shell)
+{
+	int	fd;
+	int	high;
+
+	if (op->type == REDIR_ATOMIC)
+		fd = open_atomic(op, shell->noclobber);
+	else if (op->type == REDIR_OUTPUT && shell->noclobber)
+		fd = open_noclobber(op->path, op->flags);
+	else
+		fd = open(op->path, op->flags | O_CLOEXEC, 0644);
+	if (fd == -1 || fd >= REDIR_SAVE_FD_MIN)
+		return (fd);
+	high = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_SAVE_FD_MIN);
+	if (high == -1)
+		return (fd);
+	close(fd);
+	return (high);
+}
+
+/**
+ * @brief Opens every target of a plan, then its heredoc bodies.
+ * 
+ * On failure the error is reported, the descriptors already opened are
+ * closed, the temporary files of atomic outputs removed and the plan is
+ * marked as failed.
+ * 
+ * @param plan The plan.
+ * @param shell The shell.
+ * @return true if the command can be launched.
+ */
+bool	redir_plan_open(t_redir_plan *plan, t_shell *shell)
+{
+	t_redir_op	*op;
+	int			i;
+
+	plan->failed = false;
+	i = 0;
+	while (i < plan->count)
+	{
+		op = &plan->ops[i];
+		if (op->kind == REDIR_OP_OPEN)
+			op->src_fd = open_target(op, shell);
+		if ((op->kind == REDIR_OP_OPEN && op->src_fd == -1)
+			|| (op->kind == REDIR_OP_DUP && !op->heredoc
+				&& !dup_source_open(plan, i)))
+		{
+			redir_op_error(op);
+			plan->failed = true;
+			redir_plan_close(plan);
+			return (redir_plan_finish(plan, false), false);
+		}
+		i++;
+	}
+	return (redir_plan_open_heredocs(plan));
+}
+
+/**
+ * @brief Closes the files and heredoc bodies a plan still holds in the
+ * shell.
+ * 
+ * @param plan The plan.
+ */
+void	redir_plan_close(t_redir_plan *plan)
+{
+	t_redir_op	*op;
+	int			i;
+
+	i = 0;
+	while (i < plan->count)
+	{
+		op = &plan->ops[i];
+		if ((op->kind == REDIR_OP_OPEN || op->heredoc) && op->src_fd != -1)
+		{
+			close(op->src_fd);
+			op->src_fd = -1;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Checks whether the last stage of a pipeline could not open its
+ * redirections.
+ * 
+ * That stage was never forked, so the status of the pipeline is not
+ * among the children.
+ * 
+ * @param node The root of the pipeline.
+ * @return true if the redirections of the last command failed.
+ */
+bool	pipeline_redir_failed(t_ast_node *node)
+{
+	while (node && node->type == NODE_PIPE)
+		node = node->data.pipe.right;
+	while (node && node->type == NODE_REDIRECTION)
+		node = node->data.redirection.child;
+	return (node && node->type == NODE_COMMAND && node->redir_plan
+		&& node->redir_plan->failed);
+}
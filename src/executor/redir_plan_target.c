@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_target.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:02:11 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:02:11 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file redir_plan_target.c
+ * @brief Output targets opened in noclobber or atomic mode.
+ * 
+ * With noclobber (`set -o noclobber` or `set -C`), `>` refuses to replace
+ * an existing regular file and `>|` overrides it. `>^` writes to a
+ * temporary file created in the directory of its target, which is renamed
+ * over the target once the command line succeeded: a concurrent reader
+ * sees the old file or the complete new one, never a partial one.
+ */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+#include <errno.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Opens a file for `>` without replacing a regular file.
+ * 
+ * The file is created exclusively, so no file can appear between the
+ * check and the open. An existing file that is not regular, such as
+ * /dev/null, is opened without being truncated.
+ * 
+ * @param path The target.
+ * @param flags The flags of the operation.
+ * @return The close-on-exec descriptor, or -1 with errno set (EEXIST if
+ * the file exists).
+ */
+int	open_noclobber(const char *path, int flags)
+{
+	struct stat	st;
+	int			fd;
+
+	fd = open(path, flags | O_EXCL | O_CLOEXEC, 0644);
+	if (fd != -1 || errno != EEXIST)
+		return (fd);
+	if (stat(path, &st) == 0 && !S_ISREG(st.st_mode))
+		return (open(path, (flags & ~(O_CREAT | O_TRUNC)) | O_CLOEXEC));
+	errno = EEXIST;
+	return (-1);
+}
+
+/**
+ * @brief Builds the template of the temporary file of an atomic output.
+ * 
+ * The file is hidden in the directory of the target, so that renaming it
+ * never crosses a file system: `dir/name` gives
+ * `dir/.name.minishell-XXXXXX`.
+ * 
+ * @param path The target.
+ * @return The allocated template, or NULL on allocation failure.
+ */
+static char	*atomic_tmp_path(const char *path)
+{
+	const char	*name;
+	char		*tmp;
+	size_t		dir_len;
+	size_t		name_len;
+
+	name = path + ft_strlen(path);
+	while (name > path && name[-1] != '/')
+		name--;
+	dir_len = name - path;
+	name_len = ft_strlen(name);
+	tmp = safe_malloc(dir_len + name_len + sizeof(ATOMIC_TMP_SUFFIX) + 1);
+	if (!tmp)
+		return (NULL);
+	ft_memcpy(tmp, path, dir_len);
+	tmp[dir_len] = '.';
+	ft_memcpy(tmp + dir_len + 1, name, name_len);
+	ft_memcpy(tmp + dir_len + 1 + name_len, ATOMIC_TMP_SUFFIX,
+		sizeof(ATOMIC_TMP_SUFFIX));
+	return (tmp);
+}
+
+/**
+ * @brief Opens the temporary file of a `>^` output.
+ * 
+ * The temporary file gets the permissions of the file it replaces, or the
+ * ones a new file would get. A target that is not a regular file, such as
+ * a terminal or a pipe, cannot be replaced and is opened directly.
+ * 
+ * @param op The open operation; its tmp is set to the temporary file.
+ * @param noclobber Whether an existing target must be kept.
+ * @return The close-on-exec descriptor, or -1 with errno set.
+ */
+int	open_atomic(t_redir_op *op, bool noclobber)
+{
+	struct stat	st;
+	mode_t		mask;
+	bool		exists;
+	int			fd;
+
+	exists = (stat(op->path, &st) == 0);
+	if (exists && !S_ISREG(st.st_mode))
+		return (open(op->path, op->flags | O_CLOEXEC, 0644));
+	errno = EEXIST;
+	if (exists && noclobber)
+		return (-1);
+	op->tmp = atomic_tmp_path(op->path);
+	if (!op->tmp)
+		return (-1);
+	fd = mkostemp(op->tmp, O_CLOEXEC);
+	if (fd == -1)
+		return (safe_free((void **)&op->tmp), -1);
+	mask = umask(0);
+	umask(mask);
+	if (exists)
+		fchmod(fd, st.st_mode & 07777);
+	else
+		fchmod(fd, 0644 & ~mask);
+	return (fd);
+}
+
+/**
+ * @brief Renames the atomic outputs of a plan over their targets, or
+ * removes them.
+ * 
+ * @param plan The plan.
+ * @param keep Whether the command succeeded.
+ */
+void	redir_plan_finish(t_redir_plan *plan, bool keep)
+{
+	t_redir_op	*op;
+	int			i;
+
+	i = 0;
+	while (i < plan->count)
+	{
+		op = &plan->ops[i];
+		if (op->tmp)
+		{
+			if (!keep || rename(op->tmp, op->path) == -1)
+			{
+				if (keep)
+					redir_op_error(op);
+				unlink(op->tmp);
+			}
+			safe_free((void **)&op->tmp);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Finishes the atomic outputs of every command of a command line.
+ * 
+ * @param node The root of the command line.
+ * @param status The status of the command line; the outputs are kept if
+ * it is 0.
+ */
+void	redir_plan_commit(t_ast_node *node, int status)
+{
+	while (node)
+	{
+		if (node->type == NODE_PIPE)
+		{
+			redir_plan_commit(node->data.pipe.left, status);
+			redir_plan_commit(node->data.pipe.right, status);
+		}
+		else if (node->type == NODE_REDIRECTION)
+			redir_plan_commit(node->data.redirection.child, status);
+		else if (node->type == NODE_COMMAND && node->redir_plan)
+			redir_plan_finish(node->redir_plan, status == 0);
+		node = node->next;
+	}
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_cmd.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:11:03 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 10:11:03 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file time_cmd.c
+ * @brief Implementation of the `time` keyword.
+ * 
+ * time_begin() detects a leading `time` token, parses its options and
+ * snapshots the clocks; time_end() reaps every stage that is still running
+ * and prints the report on standard error.
+ */
+
+#include "minishell.h"
+#include "executor/time_cmd.h"
+
+/**
+ * @brief Computes the time elapsed between two monotonic timestamps.
+ * 
+ * @param from The earlier timestamp.
+ * @param to The later timestamp.
+ * @return The elapsed time in microseconds.
+ */
+long long	elapsed_usec(struct timespec *from, struct timespec *to)
+{
+	return ((long long)(to->tv_sec - from->tv_sec) * 1000000LL
+		+ (to->tv_nsec - from->tv_nsec) / 1000);
+}
+
+/**
+ * @brief Computes the user or system time consumed between two snapshots.
+ * 
+ * @param end The resource usage at the end.
+ * @param start The resource usage at the start, or NULL for zero.
+ * @param user True for user time, false for system time.
+ * @return The consumed time in microseconds.
+ */
+long long	cpu_usec(struct rusage *end, struct rusage *start, bool user)
+{
+	struct timeval	a;
+	struct timeval	b;
+
+	a = end->ru_stime;
+	if (user)
+		a = end->ru_utime;
+	b.tv_sec = 0;
+	b.tv_usec = 0;
+	if (start && user)
+		b = start->ru_utime;
+	else if (start)
+		b = start->ru_stime;
+	return ((long long)(a.tv_sec - b.tv_sec) * 1000000LL
+		+ (a.tv_usec - b.tv_usec));
+}
+
+/**
+ * @brief Parses the options that follow the `time` keyword.
+ * 
+ * Supported options are -p (POSIX output format), -v (per-stage
+ * breakdown) and -- to end option parsing.
+ * 
+ * @param tokens The token array, starting at the `time` keyword.
+ * @param ctx The timing context to configure.
+ * @return The number of tokens consumed, including the keyword.
+ */
+size_t	parse_time_flags(char **tokens, t_time_ctx *ctx)
+{
+	size_t	i;
+
+	i = 1;
+	while (tokens[i] && tokens[i][0] == '-')
+	{
+		if (ft_strcmp(tokens[i], "-p") == 0)
+			ctx->posix = true;
+		else if (ft_strcmp(tokens[i], "-v") == 0)
+			ctx->verbose = true;
+		else if (ft_strcmp(tokens[i], "--") == 0)
+			return (i + 1);
+		else
+			break ;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Starts timing a command line if it begins with `time`.
+ * 
+ * @param tokens The token array of the command line.
+ * @param ctx Storage for the timing context (owned by the caller).
+ * @param shell The shell structure.
+ * @return The index of the first token of the timed command, 0 when the
+ * command line is not prefixed with `time`.
+ */
+size_t	time_begin(char **tokens, t_time_ctx *ctx, t_shell *shell)
+{
+	size_t	skip;
+
+	if (!tokens || !tokens[0] || shell->timing
+		|| ft_strcmp(tokens[0], "time") != 0)
+		return (0);
+	ft_memset(ctx, 0, sizeof(t_time_ctx));
+	skip = parse_time_flags(tokens, ctx);
+	clock_gettime(CLOCK_MONOTONIC, &ctx->start);
+	getrusage(RUSAGE_SELF, &ctx->self_start);
+	getrusage(RUSAGE_CHILDREN, &ctx->children_start);
+	shell->timing = ctx;
+	return (skip);
+}
+
+/**
+ * @brief Finishes timing and prints the report.
+ * 
+ * Stages that were left running by the executor (for instance when their
+ * output was copied to a file) are reaped here so that their resource usage
+ * is part of the report, as the whole pipeline must be accounted for.
+ * 
+ * @param ctx The timing context returned by time_begin().
+ * @param shell The shell structure.
+ */
+void	time_end(t_time_ctx *ctx, t_shell *shell)
+{
+	struct timespec	now;
+	struct rusage	self;
+	struct rusage	children;
+	size_t			i;
+	int				status;
+
+	if (shell->timing != ctx)
+		return ;
+	i = 0;
+	while (i < ctx->count)
+	{
+		if (!ctx->stages[i].reaped
+			&& shell_wait(shell, ctx->stages[i].pid, &status, 0) > 0)
+			preserve_command_exit_status(shell, status);
+		i++;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	getrusage(RUSAGE_SELF, &self);
+	getrusage(RUSAGE_CHILDREN, &children);
+	shell->timing = NULL;
+	time_print_report(ctx, &now, &self, &children);
+}
@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_cmd_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:26:50 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 10:26:50 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file time_cmd_report.c
+ * @brief Output of the `time` keyword.
+ * 
+ * The default format mirrors bash (`real 0m0.004s`), -p switches to the
+ * POSIX format (`real 0.00`). The default format ends with a maxrss line
+ * reporting the peak resident set size of the largest stage in kilobytes;
+ * the POSIX format is only the real, user and sys lines.
+ */
+
+#include "minishell.h"
+#include "executor/time_cmd.h"
+
+/**
+ * @brief Writes a duration on standard error.
+ * 
+ * @param usec The duration in microseconds.
+ * @param posix Whether to use the POSIX format (seconds, two decimals).
+ */
+static void	put_duration(long long usec, bool posix)
+{
+	if (posix)
+	{
+		ft_putnbr_fd(usec / 1000000LL, STDERR_FILENO);
+		ft_putstr_fd(".", STDERR_FILENO);
+		ft_putnbr_pad_fd((usec % 1000000LL) / 10000LL, 2, STDERR_FILENO);
+		return ;
+	}
+	ft_putnbr_fd(usec / 60000000LL, STDERR_FILENO);
+	ft_putstr_fd("m", STDERR_FILENO);
+	ft_putnbr_fd((usec / 1000000LL) % 60, STDERR_FILENO);
+	ft_putstr_fd(".", STDERR_FILENO);
+	ft_putnbr_pad_fd((usec % 1000000LL) / 1000LL, 3, STDERR_FILENO);
+	ft_putstr_fd("s", STDERR_FILENO);
+}
+
+/**
+ * @brief Prints one line of the per-stage breakdown of `time -v`.
+ * 
+ * @param stage The stage to print.
+ * @param index The position of the stage in the pipeline (from 1).
+ * @param posix Whether to use the POSIX duration format.
+ */
+static void	print_stage(t_time_stage *stage, size_t index, bool posix)
+{
+	ft_putstr_fd("[", STDERR_FILENO);
+	ft_putnbr_fd(index, STDERR_FILENO);
+	ft_putstr_fd("] ", STDERR_FILENO);
+	ft_putstr_fd(stage->name, STDERR_FILENO);
+	ft_putstr_fd(" (pid ", STDERR_FILENO);
+	ft_putnbr_fd(stage->pid, STDERR_FILENO);
+	ft_putstr_fd(")\treal ", STDERR_FILENO);
+	put_duration(elapsed_usec(&stage->start, &stage->end), posix);
+	ft_putstr_fd(" user ", STDERR_FILENO);
+	put_duration(cpu_usec(&stage->usage, NULL, true), posix);
+	ft_putstr_fd(" sys ", STDERR_FILENO);
+	put_duration(cpu_usec(&stage->usage, NULL, false), posix);
+	ft_putstr_fd(" maxrss ", STDERR_FILENO);
+	ft_putnbr_fd(stage->usage.ru_maxrss / TIME_RSS_DIVISOR, STDERR_FILENO);
+	ft_putstr_fd("k status ", STDERR_FILENO);
+	if (WIFSIGNALED(stage->status))
+		ft_putnbr_fd(128 + WTERMSIG(stage->status), STDERR_FILENO);
+	else
+		ft_putnbr_fd(WEXITSTATUS(stage->status), STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Prints a labelled duration line of the summary.
+ * 
+ * @param label The label (real, user or sys).
+ * @param usec The duration in microseconds.
+ * @param posix Whether to use the POSIX format.
+ */
+static void	print_line(const char *label, long long usec, bool posix)
+{
+	ft_putstr_fd(label, STDERR_FILENO);
+	if (posix)
+		ft_putstr_fd(" ", STDERR_FILENO);
+	else
+		ft_putstr_fd("\t", STDERR_FILENO);
+	put_duration(usec, posix);
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Lists the stages for `time -v` and finds the peak RSS.
+ * 
+ * @param ctx The timing context.
+ * @param self The shell resource usage, used when no child was forked.
+ * @return The largest ru_maxrss among the stages.
+ */
+static long	list_stages(t_time_ctx *ctx, struct rusage *self)
+{
+	size_t	i;
+	long	maxrss;
+
+	if (ctx->count == 0)
+		return (self->ru_maxrss);
+	maxrss = 0;
+	i = 0;
+	while (i < ctx->count)
+	{
+		if (ctx->verbose && ctx->stages[i].reaped)
+			print_stage(&ctx->stages[i], i + 1, ctx->posix);
+		if (ctx->stages[i].usage.ru_maxrss > maxrss)
+			maxrss = ctx->stages[i].usage.ru_maxrss;
+		i++;
+	}
+	return (maxrss);
+}
+
+/**
+ * @brief Prints the report of a timed command line on standard error.
+ * 
+ * User and system times include both the shell itself (builtins) and every
+ * child reaped while the command ran. The peak RSS is the largest one among
+ * the stages, or the shell's own when no child was forked; it is left out
+ * of the POSIX format.
+ * 
+ * @param ctx The timing context.
+ * @param now The time at which the command line finished.
+ * @param self The shell resource usage at the end.
+ * @param children The children resource usage at the end.
+ */
+void	time_print_report(t_time_ctx *ctx, struct timespec *now,
+			struct rusage *self, struct rusage *children)
+{
+	long	maxrss;
+
+	maxrss = list_stages(ctx, self);
+	if (!ctx->posix)
+		ft_putstr_fd("\n", STDERR_FILENO);
+	print_line("real", elapsed_usec(&ctx->start, now), ctx->posix);
+	print_line("user", cpu_usec(self, &ctx->self_start, true)
+		+ cpu_usec(children, &ctx->children_start, true), ctx->posix);
+	print_line("sys", cpu_usec(self, &ctx->self_start, false)
+		+ cpu_usec(children, &ctx->children_start, false), ctx->posix);
+	if (ctx->posix)
+		return ;
+	ft_putstr_fd("maxrss\t", STDERR_FILENO);
+	ft_putnbr_fd(maxrss / TIME_RSS_DIVISOR, STDERR_FILENO);
+	ft_putstr_fd("k\n", STDERR_FILENO);
+}
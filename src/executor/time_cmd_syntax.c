@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_cmd_syntax.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 10:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file time_cmd_syntax.c
+ * @brief Syntax check of the `time` keyword.
+ */
+
+#include "minishell.h"
+#include "executor/time_cmd.h"
+
+t_syntax_error	validate_input(char *input);
+
+/**
+ * @brief Validates a line, checking first that a leading `time` keyword is
+ * followed by a command.
+ * 
+ * The keyword is only stripped after expansion, so it is checked here on
+ * the lexed tokens. `time | cat` would otherwise reach the parser with a
+ * token list starting with the operator.
+ * 
+ * @param batch The lexed batch.
+ * @param line The line to validate.
+ * @param shell The shell structure.
+ * @param token Set to the misplaced operator, NULL when there is none.
+ * @return SYNTAX_UNEXPECTED_TOKEN when an operator follows the keyword and
+ * its options, the result of validate_input() otherwise.
+ */
+t_syntax_error	validate_timed_line(t_batch *batch, t_batch_line *line,
+	t_shell *shell, const char **token)
+{
+	t_time_ctx	ctx;
+	char		**tokens;
+	size_t		skip;
+
+	*token = NULL;
+	tokens = batch->tokens + line->first;
+	if (!tokens || !tokens[0] || shell->timing
+		|| ft_strcmp(tokens[0], "time") != 0)
+		return (validate_input(line->source));
+	skip = parse_time_flags(tokens, &ctx);
+	if (!is_pipe_token(tokens[skip]))
+		return (validate_input(line->source));
+	*token = tokens[skip];
+	return (SYNTAX_UNEXPECTED_TOKEN);
+}
@@ -19,6 +19,7 @@
 #include "minishell.h"
 
 size_t	ft_strlen(const char *s);
+char	*handle_quotes(char *arg);
 
 /**
  * @brief Compacts an array of arguments by removing empty strings
@@ -54,3 +55,27 @@ int	compact_args(char **args, int *i_ptr, int *j_ptr)
 	*j_ptr = j;
 	return (0);
 }
+
+/**
+ * @brief Processes all arguments of a command by handling quotes.
+ *        Replaces original args if processed result is valid.
+ * 
+ * @param command The command whose args will be processed.
+ */
+void	process_command_args(t_command *command)
+{
+	int		i;
+	char	*processed_arg;
+
+	i = 0;
+	while (command->args[i] != NULL)
+	{
+		processed_arg = handle_quotes(command->args[i]);
+		if (processed_arg)
+		{
+			safe_free((void **)&command->args[i]);
+			command->args[i] = processed_arg;
+		}
+		i++;
+	}
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   argv_limit.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:31:08 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 19:31:08 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file argv_limit.c
+ * @brief Size check of the arguments and environment of a command.
+ * 
+ * execve fails with E2BIG when the strings it copies to the new process,
+ * with their pointers, exceed ARG_MAX. A brace expansion or a glob can
+ * produce that many arguments, so the size is checked before forking and
+ * the command is reported and skipped instead.
+ */
+
+#include "minishell.h"
+#include "executor/executor.h"
+
+int		get_fd_from_str(void *str);
+void	cleanup_resources(t_command command, int fd_in);
+
+/**
+ * @brief Returns the size execve counts for the arguments of a command.
+ */
+static size_t	args_size(char **args)
+{
+	size_t	size;
+
+	size = sizeof(char *);
+	while (*args)
+		size += ft_strlen(*args++) + 1 + sizeof(char *);
+	return (size);
+}
+
+/**
+ * @brief Returns the size execve counts for the exported environment,
+ * as built by env_to_array.
+ */
+static size_t	env_size(t_env *env)
+{
+	size_t	size;
+
+	size = sizeof(char *);
+	while (env)
+	{
+		if (env->key && env->value && (env->flags & ENV_EXPORTED))
+			size += ft_strlen(env->key) + ft_strlen(env->value) + 2
+				+ sizeof(char *);
+		env = env->next;
+	}
+	return (size);
+}
+
+/**
+ * @brief Checks that a command can be passed to execve.
+ * 
+ * When its arguments and the environment exceed ARG_MAX, the error is
+ * reported and the status set to 126, as execve would make it.
+ * 
+ * @param command The command, with its quotes already removed.
+ * @param shell The shell.
+ * @return true if the command fits.
+ */
+bool	argv_fits(t_command *command, t_shell *shell)
+{
+	long	limit;
+
+	limit = sysconf(_SC_ARG_MAX);
+	if (limit <= 0 || !command->args
+		|| args_size(command->args) + env_size(shell->env) <= (size_t)limit)
+		return (true);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(command->args[0], STDERR_FILENO);
+	ft_putstr_fd(": Argument list too long\n", STDERR_FILENO);
+	shell->exit_status = 126;
+	return (false);
+}
+
+/**
+ * @brief Drops a command that was not launched.
+ * 
+ * @param command The command, freed.
+ * @param fd_in Its input, closed if it is not the standard input.
+ * @param is_pipe Whether the command feeds a pipeline.
+ * @return What the command hands to the next stage: an empty input in a
+ * pipeline, STDIN_FILENO otherwise.
+ */
+int	argv_rejected(t_command command, int fd_in, int is_pipe)
+{
+	cleanup_resources(command, fd_in);
+	if (is_pipe)
+		return (get_fd_from_str(""));
+	return (STDIN_FILENO);
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_output.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:17 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:17 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include "executor/redir_plan.h"
+
+int	get_fd_from_str(void *str);
+
+/**
+ * @brief Hands the output of a builtin to what follows it
+ *
+ * A builtin running on its own writes straight to the standard output,
+ * already redirected by its plan if it has one. In a pipeline, the output
+ * becomes an fd for the next stage to read. A failed write is reported
+ * as bash does, and the builtin then exits with status 1.
+ *
+ * @param node the command node
+ * @param str the output of the builtin
+ */
+void	builtin_output(t_ast_node *node, const char *str)
+{
+	if (node->is_pipe)
+	{
+		node->fd_in = get_fd_from_str((void *)str);
+		return ;
+	}
+	if (write_all(STDOUT_FILENO, str, ft_strlen(str)))
+		return ;
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(node->data.command.name, STDERR_FILENO);
+	ft_putstr_fd(": write error: ", STDERR_FILENO);
+	ft_putstr_fd(strerror(errno), STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	node->write_error = true;
+}
@@ -12,14 +12,22 @@
 
 #include "minishell.h"
 #include "executor/executor.h"
+#include "executor/redir_plan.h"
 
 void	handle_exit(char **args, t_shell *shell);
 void	handle_unset(char **args, t_shell *shell);
 void	handle_export(t_ast_node *node, t_shell *shell);
-void	handle_echo(t_ast_node *node, t_shell *shell);
+void	handle_echo(t_ast_node *node);
 void	handle_pwd(t_ast_node *node);
 void	handle_env(t_ast_node *node, t_env *env);
 void	handle_cd(char **args, t_shell *shell);
+void	handle_shellstats(t_ast_node *node, t_shell *shell);
+void	handle_set(t_ast_node *node, t_shell *shell);
+void	handle_readonly(t_ast_node *node, t_shell *shell);
+void	handle_arith_command(t_ast_node *node, t_shell *shell);
+bool	is_arith_command(const char *token);
+void	print_fd(int fd);
+int		get_fd_from_str(void *str);
 
 /**
  * @brief Handle node command
@@ -40,14 +48,56 @@ int	is_builtin_command(const char *command_name)
 		|| ft_strcmp(command_name, "export") == 0
 		|| ft_strcmp(command_name, "unset") == 0
 		|| ft_strcmp(command_name, "env") == 0
-		|| ft_strcmp(command_name, "cd") == 0)
+		|| ft_strcmp(command_name, "cd") == 0
+		|| ft_strcmp(command_name, "shellstats") == 0
+		|| ft_strcmp(command_name, "set") == 0
+		|| ft_strcmp(command_name, "readonly") == 0
+		|| is_arith_command(command_name))
 		return (1);
 	return (0);
 }
 
+/**
+ * @brief Runs the builtin of the given name
+ *
+ * @param node the command node
+ * @param name the name of the builtin
+ * @param shell the shell struct
+ */
+static void	dispatch_builtin(t_ast_node *node, const char *name,
+	t_shell *shell)
+{
+	if (ft_strcmp(name, "exit") == 0)
+		handle_exit(node->data.command.args, shell);
+	else if (ft_strcmp(name, "echo") == 0)
+		handle_echo(node);
+	else if (ft_strcmp(name, "pwd") == 0)
+		handle_pwd(node);
+	else if (ft_strcmp(name, "export") == 0)
+		handle_export(node, shell);
+	else if (ft_strcmp(name, "unset") == 0)
+		handle_unset(node->data.command.args, shell);
+	else if (ft_strcmp(name, "env") == 0)
+		handle_env(node, shell->env);
+	else if (ft_strcmp(name, "cd") == 0)
+		handle_cd(node->data.command.args, shell);
+	else if (ft_strcmp(name, "shellstats") == 0)
+		handle_shellstats(node, shell);
+	else if (ft_strcmp(name, "set") == 0)
+		handle_set(node, shell);
+	else if (ft_strcmp(name, "readonly") == 0)
+		handle_readonly(node, shell);
+	else if (is_arith_command(name))
+		handle_arith_command(node, shell);
+}
+
 /** 
  * @brief Handle builtin command
  *
+ * A builtin succeeds unless it sets another status or fails to write its
+ * output; exit keeps the last one, which it uses when called without
+ * argument.
+ *
  * @param node_cpy the node
  * @param shell the shell struct
  * 
@@ -55,21 +105,69 @@ int	is_builtin_command(const char *command_name)
  */
 int	handle_builtin_command(t_ast_node *node_cpy, t_shell *shell)
 {
-	if (ft_strcmp(node_cpy->data.command.name, "exit") == 0)
-		handle_exit(node_cpy->data.command.args, shell);
-	else if (ft_strcmp(node_cpy->data.command.name, "echo") == 0)
-		handle_echo(node_cpy, shell);
-	else if (ft_strcmp(node_cpy->data.command.name, "pwd") == 0)
-		handle_pwd(node_cpy);
-	else if (ft_strcmp(node_cpy->data.command.name, "export") == 0)
-		handle_export(node_cpy, shell);
-	else if (ft_strcmp(node_cpy->data.command.name, "unset") == 0)
-		handle_unset(node_cpy->data.command.args, shell);
-	else if (ft_strcmp(node_cpy->data.command.name, "env") == 0)
-		handle_env(node_cpy, shell->env);
-	else if (ft_strcmp(node_cpy->data.command.name, "cd") == 0)
-		handle_cd(node_cpy->data.command.args, shell);
+	node_cpy->write_error = false;
+	if (ft_strcmp(node_cpy->data.command.name, "exit") != 0)
+		shell->exit_status = 0;
+	dispatch_builtin(node_cpy, node_cpy->data.command.name, shell);
+	if (node_cpy->write_error)
+		shell->exit_status = 1;
 	if (node_cpy->fd_in > 2)
 		return (node_cpy->fd_in);
 	return (-1);
 }
+
+/**
+ * @brief Handle builtin command with redirections
+ *
+ * The redirection plan of the command is applied to the shell and undone
+ * once the builtin has run. When it redirects the standard output, the
+ * output of the builtin is written there, and a pipeline stage gets an
+ * empty pipe so that the next command reads EOF.
+ *
+ * @param node the command node
+ * @param shell the shell struct
+ * @param is_pipe if the command is a pipe
+ *
+ * @return the fd of the out
+ */
+int	handle_builtin_with_plan(t_ast_node *node, t_shell *shell, int is_pipe)
+{
+	int	fd;
+
+	fd = -1;
+	if (redir_plan_apply_saved(node->redir_plan) == -1)
+		shell->exit_status = 1;
+	else
+	{
+		fd = handle_builtin_command(node, shell);
+		if (fd > 2 && redir_plan_targets(node->redir_plan, STDOUT_FILENO))
+		{
+			print_fd(fd);
+			close(fd);
+			node->fd_in = STDIN_FILENO;
+			fd = -1;
+		}
+		redir_plan_restore(node->redir_plan, node->redir_plan->count);
+	}
+	if (fd == -1 && is_pipe)
+		return (get_fd_from_str(""));
+	return (fd);
+}
+
+/**
+ * @brief Tells whether a command line is a single builtin
+ *
+ * Such a command runs in the shell and writes its own output, so it needs
+ * neither the saved standard output nor a wait for children.
+ *
+ * @param node the root of the command line
+ *
+ * @return true for a builtin command, redirected or not
+ */
+bool	is_standalone_builtin(t_ast_node *node)
+{
+	while (node && node->type == NODE_REDIRECTION)
+		node = node->data.redirection.child;
+	return (node && node->type == NODE_COMMAND
+		&& is_builtin_command(node->data.command.name));
+}
@@ -15,47 +15,11 @@
 #include <sys/stat.h>
 
 void	*safe_malloc(size_t size);
-char	*ft_strjoin(const char *s1, const char *s2);
 void	safe_free(void **ptr);
 size_t	ft_strlen(const char *s);
 char	*handle_quotes(char *arg);
 char	*ft_strdup(const char *src);
 
-/**
- * @brief Concatenates the arguments.
- *
- * This function concatenates the arguments.
- *
- * @param args The arguments.
- * @return The concatenated arguments.
- */
-static char	*concatenate_args(char **args)
-{
-	char	*full_command;
-	char	*temp;
-	int		i;
-
-	full_command = ft_strdup("");
-	if (!full_command)
-		return (NULL);
-	i = 0;
-	while (args[i])
-	{
-		temp = full_command;
-		full_command = ft_strjoin(full_command, args[i]);
-		if (!full_command)
-			return (safe_free((void **)&temp), NULL);
-		safe_free((void **)&temp);
-		temp = full_command;
-		full_command = ft_strjoin(full_command, " ");
-		if (!full_command)
-			return (safe_free((void **)&temp), NULL);
-		safe_free((void **)&temp);
-		i++;
-	}
-	return (full_command);
-}
-
 /**
  * @brief Counts the arguments.
  *
@@ -85,15 +49,9 @@ static int	count_arguments(char **args)
 t_command	generate_full_command(t_ast_node *node)
 {
 	t_command	command;
-	char		*full_command;
 	int			i;
 	int			j;
 
-	command.args = NULL;
-	command.name = NULL;
-	full_command = concatenate_args(node->data.command.args);
-	if (!full_command)
-		return (command);
 	command.name = ft_strdup(node->data.command.args[0]);
 	command.args = safe_malloc(sizeof(char *)
 			* (count_arguments(node->data.command.args) + 1));
@@ -108,7 +66,7 @@ t_command	generate_full_command(t_ast_node *node)
 			command.args[j++] = ft_strdup(node->data.command.args[i++]);
 	}
 	command.args[j] = NULL;
-	return (safe_free((void **)&full_command), command);
+	return (command);
 }
 
 /**
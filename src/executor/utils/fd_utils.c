@@ -10,133 +10,80 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+/**
+ * @file fd_utils.c
+ * @brief Creation of the descriptors the shell keeps for itself.
+ * 
+ * Every pipe and copy the shell creates is close-on-exec, so a command only
+ * inherits what is explicitly moved onto its descriptors with dup2 (which
+ * clears the flag on the copy). A stray pipe end can then never reach a
+ * command and keep its reader from seeing EOF.
+ */
+
 #include "minishell.h"
 #include "executor/executor.h"
+#include "executor/redir_plan.h"
 #include <errno.h>
 
+#ifdef __linux__
+
 /**
- * @brief Get File Descriptor from String
- *
- * @param str String
- *
- * @return File Descriptor
+ * @brief Create pipe
+ * 
+ * Both ends are created close-on-exec.
+ * 
+ * @param pipe the fd
+ * @return 0 on success
  */
-int	get_fd_from_str(void *str)
+int	create_pipe(int pipe_fd[2])
 {
-	int	pipe_fd[2];
-
-	if (str != NULL)
-	{
-		if (pipe(pipe_fd) == -1)
-		{
-			perror("Error creating pipe");
-			return (-1);
-		}
-		write(pipe_fd[1], (char *)str, ft_strlen((char *)str));
-		close(pipe_fd[1]);
-		return (pipe_fd[0]);
-	}
-	else
-		return (STDIN_FILENO);
+	return (pipe2(pipe_fd, O_CLOEXEC));
 }
+#else
 
-/**
- * @brief Get File Descriptor from File
- *
- * @param filePath File Path
- *
- * @return File Descriptor
- */
-int	get_fd_from_file(char *filePath)
+int	create_pipe(int pipe_fd[2])
 {
-	int	file_fd;
-
-	file_fd = open(filePath, O_RDONLY);
-	if (file_fd == -1)
-	{
-		ft_putstr_fd("minishell: ", STDERR_FILENO);
-		ft_putstr_fd(filePath, STDERR_FILENO);
-		ft_putstr_fd(": No such file or directory\n", STDERR_FILENO);
+	if (pipe(pipe_fd) == -1)
 		return (-1);
-	}
-	return (file_fd);
+	fcntl(pipe_fd[0], F_SETFD, FD_CLOEXEC);
+	fcntl(pipe_fd[1], F_SETFD, FD_CLOEXEC);
+	return (0);
 }
+#endif
 
 /**
- * @brief Open file
- *
- * @param filePath File Path
- * @param append Append to File
- *
- * @return File Descriptor
+ * @brief Duplicates a descriptor with the close-on-exec flag.
+ * 
+ * @param fd The descriptor to duplicate.
+ * @return The lowest free descriptor above 2 now referring to fd, or -1.
  */
-static int	open_file(char *filePath, int append)
+int	dup_cloexec(int fd)
 {
-	int	flags;
-
-	flags = O_WRONLY | O_CREAT;
-	if (append)
-		flags |= O_APPEND;
-	else
-		flags |= O_TRUNC;
-	return (open(filePath, flags, 0644));
+	return (fcntl(fd, F_DUPFD_CLOEXEC, STDERR_FILENO + 1));
 }
 
 /**
- * @brief Write to File
+ * @brief Get File Descriptor from String
  *
- * @param fd File Descriptor
- * @param file_fd File Descriptor
+ * The string is served like a known heredoc body: from a pipe when it fits
+ * in one write, otherwise from a memory file, so that a large output of a
+ * builtin cannot fill the pipe before anything reads it.
  *
- * @return 0 on Success, -1 on Failure
+ * @param str String
+ *
+ * @return File Descriptor
  */
-static int	write_to_file(int fd, int file_fd)
+int	get_fd_from_str(void *str)
 {
-	ssize_t	bytes_read;
-	ssize_t	bytes_written;
-	char	buffer[4096];
+	int	fd;
 
-	if (fd < 0)
-		return (-1);
-	bytes_read = read(fd, buffer, sizeof(buffer));
-	if (bytes_read < 0)
-	{
-		perror("read error");
-		return (-1);
-	}
-	while (bytes_read > 0)
+	if (str != NULL)
 	{
-		bytes_written = write(file_fd, buffer, bytes_read);
-		if (bytes_written == -1)
-			return (perror("write"), close(file_fd), -1);
-		bytes_read = read(fd, buffer, sizeof(buffer));
-		if (bytes_read < 0)
-		{
-			perror("read error");
-			break ;
-		}
+		fd = open_buffered_input((char *)str, ft_strlen((char *)str));
+		if (fd == -1)
+			perror("Error creating pipe");
+		return (fd);
 	}
-	return (0);
-}
-
-/**
- * @brief Write File Descriptor to File
- *
- * @param fd File Descriptor
- * @param filePath File Path
- * @param append Append to File
- *
- * @return 0 on Success, -1 on Failure
- */
-int	ft_write_fd_to_file(int fd, char *filePath, int append)
-{
-	int	file_fd;
-
-	file_fd = open_file(filePath, append);
-	if (file_fd == -1)
-		return (perror("open"), -1);
-	if (write_to_file(fd, file_fd) == -1)
-		return (-1);
-	close(file_fd);
-	return (0);
+	else
+		return (STDIN_FILENO);
 }
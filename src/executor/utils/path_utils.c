@@ -21,17 +21,18 @@ char	*build_full_path(const char *dir, const char *command);
 /**
  * @brief Gets the PATH environment variable.
  *
- * This function gets the PATH environment variable.
+ * This function gets a copy of the PATH environment variable, which the
+ * search cuts up: the value itself is shared and must not change.
  *
  * @param env The environment variable.
- * @return A pointer to the PATH environment variable.
+ * @return A copy of the PATH environment variable, or NULL.
  */
 static char	*get_path_from_env(t_env *env)
 {
 	while (env)
 	{
-		if (ft_strcmp(env->key, "PATH") == 0)
-			return (env->value);
+		if (ft_strcmp(env->key, "PATH") == 0 && env->value)
+			return (ft_strdup(env->value));
 		env = env->next;
 	}
 	return (NULL);
@@ -14,12 +14,15 @@
 #include "executor/executor.h"
 
 void		set_exit_code(t_shell *shell, int status);
-int			handle_input_redir(t_ast_node *node, t_shell *shell);
-int			handle_heredoc_redir(t_ast_node *node, t_shell *shell);
+int			get_fd_from_str(void *str);
 
 /**
  * @brief Executes the left node of a pipe (can be command or redirection).
  * 
+ * A left side without output (a builtin such as export, or a command whose
+ * output was redirected) gives the right side an empty pipe, so that it
+ * reads EOF instead of the terminal.
+ * 
  * @param left_node Left AST node.
  * @param shell Shell state.
  * @return int Output file descriptor from execution.
@@ -29,17 +32,10 @@ int	process_pipe_left(t_ast_node *left_node, t_shell *shell)
 	int			fd;
 	t_ast_node	*temp;
 
-	if (left_node->type == NODE_REDIRECTION)
-	{
-		if (left_node->data.redirection.type == REDIR_HEREDOC)
-			return (handle_heredoc_redir(left_node, shell));
-		if (left_node->data.redirection.type == REDIR_INPUT)
-			return (handle_input_redir(left_node, shell));
-	}
 	temp = left_node;
 	fd = execute_command(&temp, shell, 1);
 	if (fd == -1)
-		return (STDIN_FILENO);
+		return (get_fd_from_str(""));
 	return (fd);
 }
 
@@ -61,7 +57,7 @@ int	handle_pipe_and_wait(t_shell *shell, pid_t pid, t_pipe_data data)
 		close(data.pipe_fds[1]);
 	if (!data.is_pipe)
 	{
-		waitpid(pid, &status, 0);
+		shell_wait(shell, pid, &status, 0);
 		preserve_command_exit_status(shell, status);
 		
 		// Handle signals display
@@ -78,19 +74,6 @@ int	handle_pipe_and_wait(t_shell *shell, pid_t pid, t_pipe_data data)
 	return (data.pipe_fds[0]);
 }
 
-/**
- * @brief Create pipe
- * 
- * @param pipe the fd
- * @return 0 on success
- */
-int	create_pipe(int pipe_fd[2])
-{
-	if (pipe(pipe_fd) == -1)
-		return (-1);
-	return (0);
-}
-
 /**
  * @brief Executes the left (child) side of a pipe.
  * 
@@ -115,6 +98,7 @@ void	execute_child(t_ast_node *node, t_shell *shell, int pipe_fds[2])
 			close(left_fd);
 	}
 	close(pipe_fds[1]);
+	procsub_reap(shell);
 	exit(shell->exit_status);
 }
 
@@ -147,7 +131,7 @@ int	execute_parent(t_ast_node *node, t_shell *shell,
 	else
 		right_fd = STDOUT_FILENO;
 	close(pipe_fds[0]);
-	waitpid(pid, &status, 0);
+	shell_wait(shell, pid, &status, 0);
 	preserve_command_exit_status(shell, status);
 	return (right_fd);
 }
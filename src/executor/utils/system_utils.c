@@ -116,7 +116,7 @@ int	handle_ls_case(t_ast_node *node, t_shell *shell)
 	t_ast_node		*temp;
 	int				cmd_fd;
 
-	original_stdout = dup(STDOUT_FILENO);
+	original_stdout = dup_cloexec(STDOUT_FILENO);
 	original_term = isatty(STDOUT_FILENO);
 	if (original_term)
 		dup2(original_stdout, STDOUT_FILENO);
@@ -77,31 +77,6 @@ t_ast_node	*find_execution_node(t_ast_node *cmd, int *is_pipe)
 	return (NULL);
 }
 
-/**
- * @brief  Find the output redirection.
- *
- * This function finds the output redirection.
- *
- * @param cmd_node The command node.
- * @return A pointer to the output redirection node.
- */
-t_ast_node	*find_output_redirection(t_ast_node *cmd_node)
-{
-	t_ast_node	*output_redir;
-
-	while (cmd_node && cmd_node->type == NODE_REDIRECTION)
-	{
-		if (cmd_node->data.redirection.type == REDIR_OUTPUT
-			|| cmd_node->data.redirection.type == REDIR_APPEND)
-		{
-			output_redir = cmd_node;
-			cmd_node->data.redirection.type = REDIR_NONE;
-		}
-		cmd_node = cmd_node->data.redirection.child;
-	}
-	return (output_redir);
-}
-
 /**
  * @brief Print File Descriptor
  *
@@ -134,25 +109,3 @@ void	print_fd(int fd)
 		}
 	}
 }
-
-/**
- * @brief Executes a command from a redirection node.
- * 
- * @param cmd Command AST node.
- * @param shell Shell state.
- * @param out_fd Output file descriptor to assign if needed.
- * @return int File descriptor from executed command.
- */
-int	execute_from_cmd_node(t_ast_node *cmd, t_shell *shell, int out_fd)
-{
-	t_ast_node	*temp;
-	int			fd;
-
-	if (!cmd || cmd->type != NODE_COMMAND)
-		return (STDIN_FILENO);
-	if (out_fd != STDOUT_FILENO)
-		cmd->fd_out = out_fd;
-	temp = cmd;
-	fd = execute_command(&temp, shell, 1);
-	return (fd);
-}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:18:27 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 10:18:27 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file wait_utils.c
+ * @brief Child bookkeeping helpers shared by the executor.
+ * 
+ * Every forked command is announced with register_child() and all the
+ * places where the executor waits for its children go through shell_wait(),
+ * which uses wait4() so that the resource usage of every reaped stage can be
+ * attributed to a running `time` keyword and to the profiler.
+ */
+
+#include "minishell.h"
+#include "executor/time_cmd.h"
+#include "core/profile.h"
+
+/**
+ * @brief Looks up a registered stage by process id.
+ * 
+ * @param ctx The timing context.
+ * @param pid The process id to look for.
+ * @return The stage, or NULL if the process was not registered.
+ */
+static t_time_stage	*find_stage(t_time_ctx *ctx, pid_t pid)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < ctx->count)
+	{
+		if (ctx->stages[i].pid == pid)
+			return (&ctx->stages[i]);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Registers a freshly forked stage in the running `time` keyword.
+ * 
+ * Stages beyond TIME_MAX_STAGES are still counted in the totals through
+ * RUSAGE_CHILDREN but are not listed by `time -v`.
+ * 
+ * @param shell The shell structure.
+ * @param pid The process id of the forked child.
+ * @param name The command name of the stage.
+ */
+static void	time_register_stage(t_shell *shell, pid_t pid, const char *name)
+{
+	t_time_stage	*stage;
+
+	if (!shell->timing || shell->timing->count >= TIME_MAX_STAGES)
+		return ;
+	stage = &shell->timing->stages[shell->timing->count++];
+	ft_memset(stage, 0, sizeof(t_time_stage));
+	stage->pid = pid;
+	if (name)
+		ft_strncpy(stage->name, name, TIME_NAME_LEN - 1);
+	clock_gettime(CLOCK_MONOTONIC, &stage->start);
+}
+
+/**
+ * @brief Announces a freshly forked command.
+ * 
+ * @param shell The shell structure.
+ * @param pid The process id of the child.
+ * @param name The command name.
+ * @param spawn The prof_start() timestamp taken before fork().
+ */
+void	register_child(t_shell *shell, pid_t pid, const char *name,
+			uint64_t spawn)
+{
+	time_register_stage(shell, pid, name);
+	prof_child_spawned(pid, spawn);
+}
+
+/**
+ * @brief Waits for a child process and records its resource usage.
+ * 
+ * Behaves like waitpid() but collects the rusage of the reaped child with
+ * wait4() and stores it in the matching stage of the `time` keyword.
+ * 
+ * @param shell The shell structure.
+ * @param pid The process to wait for, or -1 for any child.
+ * @param status Where to store the wait status.
+ * @param options The waitpid() options (e.g. WNOHANG).
+ * @return The reaped process id, 0 or -1 as waitpid() does.
+ */
+pid_t	shell_wait(t_shell *shell, pid_t pid, int *status, int options)
+{
+	struct rusage	usage;
+	t_time_stage	*stage;
+	pid_t			reaped;
+
+	reaped = wait4(pid, status, options, &usage);
+	prof_child_reaped(reaped);
+	if (reaped <= 0 || !shell || !shell->timing)
+		return (reaped);
+	stage = find_stage(shell->timing, reaped);
+	if (!stage)
+		return (reaped);
+	clock_gettime(CLOCK_MONOTONIC, &stage->end);
+	stage->usage = usage;
+	stage->status = *status;
+	stage->reaped = true;
+	return (reaped);
+}
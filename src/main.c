@@ -58,6 +58,66 @@ int	ft_main_loop(t_shell *shell)
 	return (0);
 }
 
+/**
+ * @brief Parses the command-line arguments.
+ *
+ * The accepted usage is `minishell [--profile] [script]`. Any other
+ * combination exits immediately with a failure status. A lone
+ * --build-info prints the build profile and exits.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv An array of command-line argument strings.
+ * @param profile Set to true when --profile is given.
+ * @return The script path, or NULL for an interactive session.
+ */
+static char	*parse_arguments(int argc, char **argv, bool *profile)
+{
+	int	i;
+
+	*profile = false;
+	if (argc == 2 && ft_strcmp(argv[1], BUILD_INFO_FLAG) == 0)
+	{
+		print_build_info(STDOUT_FILENO);
+		exit(EXIT_SUCCESS);
+	}
+	i = 1;
+	if (i < argc && ft_strcmp(argv[i], PROF_FLAG) == 0)
+	{
+		*profile = true;
+		i++;
+	}
+	if (i + 1 < argc)
+		exit(EXIT_FAILURE);
+	return (argv[i]);
+}
+
+/**
+ * @brief Initializes the state of the shell, but its environment.
+ *
+ * @param shell The shell structure.
+ * @param script The script to run, or NULL for an interactive session.
+ * @param name The name the shell was run as, the value of `$0` when no
+ * script is given.
+ */
+static void	init_shell(t_shell *shell, char *script, char *name)
+{
+	shell->exit_status = 0;
+	shell->ast = NULL;
+	shell->timing = NULL;
+	shell->interactive = (script == NULL);
+	shell->heredoc_bodies = NULL;
+	shell->heredoc_next = 0;
+	shell->procsub = NULL;
+	shell->noclobber = false;
+	shell->expand_error = false;
+	shell->name = name;
+	if (script)
+		shell->name = script;
+	shell->pid = getpid();
+	shell->last_bg = 0;
+	shell->subst_depth = 0;
+}
+
 /**
  * @brief Entry point for the minishell program.
  *
@@ -66,28 +126,31 @@ int	ft_main_loop(t_shell *shell)
  * are properly converted into a linked list structure for internal use.
  *
  * @param argc The number of command-line arguments.
- * @param argv An array of command-line argument strings (unused in this 
- * function).
+ * @param argv An array of command-line argument strings: an optional
+ * --profile flag (self-profiling mode) and an optional script to run.
  * @param envp An array of strings representing environment variables.
  * @return int Returns 0 upon successful termination.
  * 
- * @note If more than one argument is passed to the program, it exits
- * immediately with a failure status.
+ * @note When a script is given, it is run non-interactively and the shell
+ * exits with the status of its last command.
  */
 int	main(int argc, char **argv, char **envp)
 {
 	t_shell	shell;
+	char	*script;
+	bool	profile;
 
-	(void)argv;
-	if (argc != 1)
-		exit(EXIT_FAILURE);
+	script = parse_arguments(argc, argv, &profile);
 	shell.env = env_to_linked_list(envp);
 	if (!shell.env)
 	{
 		ft_error_msg("Error", "Failed to initialize environment");
 		exit(EXIT_FAILURE);
 	}
-	shell.exit_status = 0;
+	init_shell(&shell, script, argv[0]);
+	prof_init(profile, shell.env);
+	if (script)
+		run_script(script, &shell);
 	setup_interactive_signals();
 	ft_main_loop(&shell);
 	return (0);
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_arith.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:05:31 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 17:05:31 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parser_arith.c
+ * @brief Lexing helpers for arithmetic expansions and commands.
+ * 
+ * `$((expr))` is a command substitution whose list is one parenthesized
+ * group, so the lexers already keep it whole. A word starting with `((`
+ * whose inner group closes right before the last `)` is an arithmetic
+ * command, kept as a single token so that `<`, `>` and `|` in the
+ * expression are not operators.
+ */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the length of the arithmetic command starting at s.
+ * 
+ * @param s The input, at a `(`.
+ * @return The length up to and including the closing `))`, or 0 if s does
+ * not start an arithmetic command closed on the same line.
+ */
+size_t	arith_command_len(const char *s)
+{
+	size_t	len;
+
+	if (s[0] != '(' || s[1] != '(')
+		return (0);
+	len = paren_group_len(s);
+	if (len < 4 || paren_group_len(s + 1) != len - 2)
+		return (0);
+	return (len);
+}
+
+/**
+ * @brief Returns the length of the arithmetic expansion starting at s.
+ * 
+ * @param s The input, at a `$`.
+ * @return The length of `$((expr))`, or 0 if s does not start one.
+ */
+size_t	arith_subst_len(const char *s)
+{
+	size_t	len;
+
+	if (s[0] != '$')
+		return (0);
+	len = arith_command_len(s + 1);
+	if (len == 0)
+		return (0);
+	return (len + 1);
+}
+
+/**
+ * @brief Checks whether a token is a whole arithmetic command.
+ * 
+ * @param token The token.
+ * @return true for `((expr))`.
+ */
+bool	is_arith_command(const char *token)
+{
+	size_t	len;
+
+	if (!token)
+		return (false);
+	len = arith_command_len(token);
+	return (len > 0 && token[len] == '\0');
+}
+
+/**
+ * @brief Returns the length of the substitution or arithmetic command
+ * starting at s, which the syntax checks skip as a whole.
+ * 
+ * @param s The input.
+ * @return The length of `$(list)`, `${...}` or `((expr))`, or 0.
+ */
+size_t	subst_len(const char *s)
+{
+	if (s[0] == '$')
+		return (dollar_subst_len(s));
+	return (arith_command_len(s));
+}
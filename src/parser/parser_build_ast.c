@@ -20,6 +20,7 @@
 
 void	print_tokens(char **tokens);
 void	print_ast(t_ast *ast); //DEBUG
+void	*safe_malloc(size_t size);
 
 /**
  * @brief Initializes the parser state structure.
@@ -44,11 +45,82 @@ bool	init_state(t_parser_state *state, char **tokens,
 	state->tokens = tokens;
 	state->ast = ast;
 	state->last_node = NULL;
+	state->last_command_node = NULL;
 	state->env = env;
 	state->index = 0;
 	return (true);
 }
 
+/**
+ * @brief Moves the command word of a simple command before its
+ * redirections.
+ * 
+ * A simple command may start with redirections (`> out echo hi`). The
+ * parser expects the command word first, so the first word that is not a
+ * redirection target is rotated to the front of the segment. The order of
+ * the redirections is kept. A segment made only of redirections is left
+ * as it is.
+ * 
+ * @param tokens The token array.
+ * @param start The index of the first token of the simple command.
+ */
+static void	hoist_command_word(char **tokens, size_t start)
+{
+	size_t	i;
+	char	*word;
+
+	i = start;
+	while (tokens[i] && is_redirection_token(tokens[i]) && tokens[i + 1]
+		&& !is_pipe_token(tokens[i + 1]))
+		i += 2;
+	if (i == start || !tokens[i] || is_pipe_token(tokens[i])
+		|| is_redirection_token(tokens[i]) || is_command_group(tokens[i]))
+		return ;
+	word = tokens[i];
+	while (i > start)
+	{
+		tokens[i] = tokens[i - 1];
+		i--;
+	}
+	tokens[start] = word;
+}
+
+/**
+ * @brief Puts the command word first in every simple command of a line.
+ * 
+ * The caller owns the strings and may match them by position, so the
+ * reordering is done on a copy of the pointer array.
+ * 
+ * @param tokens The token array.
+ * @return The reordered copy, to be freed by the caller.
+ */
+static char	**hoist_command_words(char **tokens)
+{
+	char	**ordered;
+	size_t	count;
+	size_t	i;
+
+	count = 0;
+	while (tokens[count])
+		count++;
+	ordered = safe_malloc(sizeof(char *) * (count + 1));
+	i = 0;
+	while (i <= count)
+	{
+		ordered[i] = tokens[i];
+		i++;
+	}
+	hoist_command_word(ordered, 0);
+	i = 0;
+	while (ordered[i])
+	{
+		if (is_pipe_token(ordered[i]))
+			hoist_command_word(ordered, i + 1);
+		i++;
+	}
+	return (ordered);
+}
+
 /**
  * @brief builds the abstract syntax tree (AST) from the tokenized input.
  * 
@@ -67,18 +139,22 @@ bool	init_state(t_parser_state *state, char **tokens,
 void	build_ast(char **tokens, t_ast *ast, t_env *cp_env)
 {
 	t_parser_state	state;
+	char			**ordered;
 
 	if (!tokens || !ast || !cp_env)
 	{
 		ft_error_msg(PARSER_ERR, "Invalid parameters in build_ast");
 		return ;
 	}
-	if (!init_state(&state, tokens, ast, cp_env))
+	ordered = hoist_command_words(tokens);
+	if (!init_state(&state, ordered, ast, cp_env))
 	{
 		ft_error_msg(PARSER_ERR, "Failed to initialize parser state");
+		safe_free((void **)&ordered);
 		return ;
 	}
 	ast->syntax_error = SYNTAX_OK;
 	while (state.tokens[state.index] && ast->syntax_error == SYNTAX_OK)
 		handle_current_token(&state);
+	safe_free((void **)&ordered);
 }
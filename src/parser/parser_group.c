@@ -87,5 +87,7 @@ t_ast_node	*parse_command_group(char **tokens, int length, t_env *cp_env)
 	temp_ast.syntax_error = SYNTAX_OK;
 	build_ast(group_tokens, &temp_ast, cp_env);
 	free_group_tokens(group_tokens, length);
+	if (temp_ast.syntax_error != SYNTAX_OK)
+		free_ast_node(&temp_ast.root);
 	return (temp_ast.root);
 }
@@ -97,6 +97,9 @@ void	handle_command(t_parser_state *state)
 	int			start;
 	int			token_count;
 
+	cmd_tokens = NULL;
+	start = 0;
+	token_count = 0;
 	validate_and_allocate_tokens(state, &cmd_tokens, &start, &token_count);
 	if (!cmd_tokens)
 		return ;
@@ -51,7 +51,9 @@ bool	is_valid_state(t_parser_state *state)
  * @brief Gets the number of tokens in the command.
  * 
  * This function calculates the number of tokens in the command starting
- * from the current position in the parser state.
+ * from the current position in the parser state. It stops at the first
+ * operator: redirections are parsed by handle_redirection, which also
+ * appends the words that follow them to the command.
  * 
  * @param state A pointer to the parser state structure.
  * @return The number of tokens in the command.
@@ -65,15 +67,8 @@ size_t	get_token_count(t_parser_state *state)
 
 	token_count = 0;
 	i = state->index;
-	while (state->tokens[i])
+	while (state->tokens[i] && !is_operator_token(state->tokens[i]))
 	{
-		if (is_redirection_token(state->tokens[i]))
-		{
-			i += 2;
-			continue ;
-		}
-		if (is_operator_token(state->tokens[i]))
-			break ;
 		token_count++;
 		i++;
 	}
@@ -127,11 +122,6 @@ void	copy_command_tokens(char **cmd_tokens, t_parser_state *state,
 	j = 0;
 	while (j < token_count && state->tokens[start + i])
 	{
-		if (is_redirection_token(state->tokens[start + i]))
-		{
-			i += 2;
-			continue ;
-		}
 		if (is_operator_token(state->tokens[start + i]))
 			break ;
 		cmd_tokens[j] = ft_strdup(state->tokens[start + i]);
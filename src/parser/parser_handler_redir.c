@@ -70,7 +70,8 @@ void	handle_redirection(t_parser_state *state, int redir_pos)
 
 	if (!validate_redirection(state, redir_pos))
 	{
-		state->index += 2;
+		if (state->ast->syntax_error == SYNTAX_OK)
+			state->index += 2;
 		return ;
 	}
 	redir_node = prepare_redir_node(state, redir_pos);
@@ -36,7 +36,7 @@ static bool	update_command_args(t_parser_state *state, t_ast_node *cmd_node)
 	int		count;
 	char	**new_args;
 
-	count = count_cmd_args(cmd_node);
+	count = count_additional_args(state);
 	new_args = prepare_additional_args(state, cmd_node, count);
 	if (!new_args)
 		return (false);
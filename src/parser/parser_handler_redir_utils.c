@@ -32,6 +32,8 @@
  * @param redir_pos Position of the redirection operator in the input.
  * 
  * @note The redirection operator is expected to be at the specified position.
+ * A malformed redirection sets the syntax error of the AST and leaves the
+ * index on the offending token, so the line is reported and not run.
  */
 bool	validate_redirection(t_parser_state *state, int redir_pos)
 {
@@ -40,22 +42,19 @@ bool	validate_redirection(t_parser_state *state, int redir_pos)
 		ft_error_msg(PARSER_ERR, "Invalid state or NULL token");
 		return (false);
 	}
-	if (!state->tokens[redir_pos + 1])
-	{
-		ft_error_msg(PARSER_ERR, "Syntax error: Missing file for redirection");
-		return (false);
-	}
-	if (is_redirection_token(state->tokens[redir_pos + 1])
+	state->index = redir_pos + 1;
+	if (!state->tokens[redir_pos + 1]
+		|| is_redirection_token(state->tokens[redir_pos + 1])
 		|| is_pipe_token(state->tokens[redir_pos + 1])
 		|| is_command_group(state->tokens[redir_pos + 1]))
 	{
-		ft_error_msg(PARSER_ERR,
-			"Syntax error: Invalid file name for redirection");
+		state->ast->syntax_error = SYNTAX_UNEXPECTED_TOKEN;
 		return (false);
 	}
+	state->index = redir_pos;
 	if (!state->last_command_node)
 	{
-		ft_error_msg(PARSER_ERR, "Syntax error: Redirection without a command");
+		state->ast->syntax_error = SYNTAX_UNEXPECTED_TOKEN;
 		return (false);
 	}
 	return (true);
@@ -96,5 +95,7 @@ t_ast_node	*prepare_redir_node(t_parser_state *state, int redir_pos)
 		safe_free((void **)&filename);
 		return (NULL);
 	}
+	redir_node->data.redirection.fd = get_redirection_fd(
+			state->tokens[redir_pos]);
 	return (redir_node);
 }
@@ -20,6 +20,33 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Checks the target of the redirection operator at input[*i].
+ *
+ * A process substitution is skipped as a whole, whether it is the target
+ * of the operator or stands on its own.
+ *
+ * @param input The input string.
+ * @param i Pointer to the index of the operator, moved to the target.
+ * @return true if the operator has no target.
+ */
+static bool	is_missing_target(const char *input, int *i)
+{
+	if (!procsub_len(input + *i))
+	{
+		*i += redirection_operator_len(input + *i);
+		while (ft_isspace(input[*i]))
+			(*i)++;
+	}
+	if (procsub_len(input + *i))
+	{
+		*i += procsub_len(input + *i) - 1;
+		return (false);
+	}
+	return (!input[*i] || input[*i] == '>' || input[*i] == '<'
+		|| input[*i] == '|');
+}
+
 /**
  * @brief Checks if the input contains invalid redirections.
  *
@@ -42,17 +69,9 @@ bool	has_invalid_redirection(const char *input)
 			quote = input[i];
 		else if (input[i] == quote)
 			quote = '\0';
-		else if ((input[i] == '>' || input[i] == '<') && !quote)
-		{
-			i++;
-			if (input[i] == input[i - 1])
-				i++;
-			while (ft_isspace(input[i]))
-				i++;
-			if (!input[i] || input[i] == '>' || input[i] == '<'
-				|| input[i] == '|')
-				return (true);
-		}
+		else if ((input[i] == '>' || input[i] == '<') && !quote
+			&& is_missing_target(input, &i))
+			return (true);
 		i++;
 	}
 	return (false);
@@ -38,6 +38,8 @@ static bool	initial_pipe_check(const char *input)
  *
  * This function iterates through the input string, updating the state of
  * quotes and checking for valid command structures around pipe characters.
+ * The `|` of a `>|` redirection is not a pipe, and substitutions and
+ * arithmetic commands are skipped as a whole.
  *
  * @param input The input string to process.
  * @param i Pointer to the current index in the input string.
@@ -48,13 +50,19 @@ static bool	initial_pipe_check(const char *input)
 static bool	process_quotes_and_commands(const char *input, int *i,
 	bool *found_command, char *quote)
 {
-	if ((input[*i] == '\'' || input[*i] == '"') && !*quote)
+	if (!*quote && subst_len(input + *i))
+	{
+		*i += subst_len(input + *i) - 1;
+		*found_command = true;
+	}
+	else if ((input[*i] == '\'' || input[*i] == '"') && !*quote)
 		*quote = input[*i];
 	else if (input[*i] == *quote)
 		*quote = '\0';
 	else if (input[*i] != '|' && !ft_isspace(input[*i]))
 		*found_command = true;
-	else if (input[*i] == '|' && !*quote)
+	else if (input[*i] == '|' && !*quote
+		&& (*i == 0 || input[*i - 1] != '>'))
 	{
 		if (!*found_command || input[*i + 1] == '|')
 			return (true);
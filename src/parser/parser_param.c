@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_param.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:05:12 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:05:12 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parser_param.c
+ * @brief Lexing helpers for braced parameter expansions.
+ * 
+ * `${name op word}` may hold blanks, quotes and operators in its word, so
+ * the lexers keep it whole inside its word, like a `$(list)`.
+ */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the length of the braced parameter expansion starting
+ * at s.
+ * 
+ * Nested `${...}` and quoted braces are skipped.
+ * 
+ * @param s The input, at a `$`.
+ * @return The length up to and including the matching `}`, or 0 if s does
+ * not start one or it is not closed on the same line.
+ */
+size_t	param_subst_len(const char *s)
+{
+	size_t	i;
+	int		depth;
+	char	quote;
+
+	if (s[0] != '$' || s[1] != '{')
+		return (0);
+	i = 2;
+	depth = 1;
+	quote = '\0';
+	while (s[i] && s[i] != '\n')
+	{
+		if (quote && s[i] == quote)
+			quote = '\0';
+		else if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (!quote && s[i] == '$' && s[i + 1] == '{')
+			depth++;
+		else if (!quote && s[i] == '}')
+			depth--;
+		i++;
+		if (depth == 0)
+			return (i);
+	}
+	return (0);
+}
+
+/**
+ * @brief Returns the length of the `$(list)` or `${...}` starting at s.
+ * 
+ * @param s The input, at a `$`.
+ * @return The length of the substitution, or 0.
+ */
+size_t	dollar_subst_len(const char *s)
+{
+	size_t	len;
+
+	len = cmdsub_len(s);
+	if (len == 0)
+		len = param_subst_len(s);
+	return (len);
+}
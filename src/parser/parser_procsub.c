@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_procsub.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:11 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:11 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file parser_procsub.c
+ * @brief Lexing helpers for process and command substitutions.
+ * 
+ * `<(list)` and `>(list)` are kept as a single word, from the operator to
+ * the matching closing parenthesis, so that the list inside is neither
+ * split nor expanded with the outer command line. `$(list)` is kept whole
+ * inside the word it belongs to. Parentheses inside quotes do not count,
+ * but a `$(list)` inside double quotes is skipped whole, as its own quotes
+ * start afresh.
+ */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the length of the parenthesized group starting at s.
+ * 
+ * @param s The input, at a `(`.
+ * @return The length up to and including the matching `)`, or 0 if it is
+ * not closed on the same line.
+ */
+size_t	paren_group_len(const char *s)
+{
+	size_t	i;
+	int		depth;
+	char	quote;
+
+	i = 1;
+	depth = 1;
+	quote = '\0';
+	while (s[i] && s[i] != '\n')
+	{
+		if (quote == '"' && s[i] == '$' && s[i + 1] == '(')
+			i += paren_group_len(s + i + 1);
+		else if (quote && s[i] == quote)
+			quote = '\0';
+		else if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (!quote && s[i] == '(')
+			depth++;
+		else if (!quote && s[i] == ')')
+			depth--;
+		i++;
+		if (depth == 0)
+			return (i);
+	}
+	return (0);
+}
+
+/**
+ * @brief Returns the length of the process substitution starting at s.
+ * 
+ * @param s The input, at a `<` or `>`.
+ * @return The length up to and including the matching `)`, or 0 if s does
+ * not start a process substitution or it is not closed on the same line.
+ */
+size_t	procsub_len(const char *s)
+{
+	size_t	len;
+
+	if ((s[0] != '<' && s[0] != '>') || s[1] != '(')
+		return (0);
+	len = paren_group_len(s + 1);
+	if (len == 0)
+		return (0);
+	return (len + 1);
+}
+
+/**
+ * @brief Returns the length of the command substitution starting at s.
+ * 
+ * @param s The input, at a `$`.
+ * @return The length up to and including the matching `)`, or 0 if s does
+ * not start a command substitution or it is not closed on the same line.
+ */
+size_t	cmdsub_len(const char *s)
+{
+	size_t	len;
+
+	if (s[0] != '$' || s[1] != '(')
+		return (0);
+	len = paren_group_len(s + 1);
+	if (len == 0)
+		return (0);
+	return (len + 1);
+}
+
+/**
+ * @brief Checks whether a token is a whole process substitution.
+ * 
+ * @param token The token.
+ * @return true for `<(list)` and `>(list)`.
+ */
+bool	is_procsub_word(const char *token)
+{
+	size_t	len;
+
+	if (!token)
+		return (false);
+	len = procsub_len(token);
+	return (len > 0 && token[len] == '\0');
+}
+
+/**
+ * @brief Lexes a whole `$(list)` or `${...}` of a batch as part of the
+ * current word, or a whole `((expr))` starting a word.
+ * 
+ * @param batch The batch.
+ * @param input The input.
+ * @param i Index of the current character, moved to the closing
+ * parenthesis or brace.
+ * @return true if one was lexed.
+ */
+bool	lex_cmdsub(t_batch *batch, char *input, size_t *i)
+{
+	size_t	len;
+
+	len = 0;
+	if (input[*i] == '$' && batch->quote != '\'')
+		len = dollar_subst_len(input + *i);
+	else if (input[*i] == '(' && !batch->word && !batch->quote)
+		len = arith_command_len(input + *i);
+	if (len == 0)
+		return (false);
+	if (!batch->word)
+		batch->word = input + *i;
+	*i += len - 1;
+	return (true);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_redir_fd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:14:07 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 12:14:07 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parser_redir_fd.c
+ * @brief Helpers for redirection operators that carry a file descriptor.
+ * 
+ * A redirection operator may start with the number of the descriptor it
+ * applies to (`2>`, `3<`, `2>>`) and `<` or `>` may be followed by `&` to
+ * duplicate or close a descriptor (`2>&1`, `<&3`, `2>&-`). `>|` overrides
+ * noclobber and `>^` replaces the file atomically. The number is
+ * only part of the operator when it is written right before it, so `a2>f`
+ * still redirects the standard output.
+ */
+
+#include "minishell.h"
+
+/**
+ * @brief Checks whether a word is a file descriptor prefix.
+ * 
+ * @param word The start of the word.
+ * @param len The length of the word.
+ * @return true if the word is made of digits only.
+ */
+bool	is_fd_prefix(const char *word, size_t len)
+{
+	size_t	i;
+
+	if (len == 0)
+		return (false);
+	i = 0;
+	while (i < len)
+	{
+		if (word[i] < '0' || word[i] > '9')
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Returns the length of the operator starting at s.
+ * 
+ * @param s The input, at a `|`, `<` or `>`.
+ * @return 1 for `|`, `<` and `>`, 2 for `<<`, `>>`, `<&`, `>&`, `>|` and
+ * `>^`, 3 for `<<<`.
+ */
+size_t	redirection_operator_len(const char *s)
+{
+	if (s[0] != '<' && s[0] != '>')
+		return (1);
+	if (s[0] == '<' && s[1] == '<' && s[2] == '<')
+		return (3);
+	if (s[1] == s[0] || s[1] == '&')
+		return (2);
+	if (s[0] == '>' && (s[1] == '|' || s[1] == '^'))
+		return (2);
+	return (1);
+}
+
+/**
+ * @brief Skips the file descriptor prefix of a redirection token.
+ * 
+ * @param token The token.
+ * @return The first character after the leading digits.
+ */
+const char	*skip_fd_prefix(const char *token)
+{
+	while (*token >= '0' && *token <= '9')
+		token++;
+	return (token);
+}
+
+/**
+ * @brief Returns the file descriptor written before a redirection operator.
+ * 
+ * @param token The redirection token.
+ * @return The descriptor, -1 if the token has no prefix, or INT_MAX if it
+ * does not fit in an int (the redirection then fails when applied).
+ */
+int	get_redirection_fd(const char *token)
+{
+	long	fd;
+
+	if (!token || *token < '0' || *token > '9')
+		return (-1);
+	fd = 0;
+	while (*token >= '0' && *token <= '9')
+	{
+		fd = fd * 10 + (*token - '0');
+		if (fd > INT_MAX)
+			return (INT_MAX);
+		token++;
+	}
+	return ((int)fd);
+}
@@ -59,6 +59,8 @@ t_ast_node	*create_pipe_redirection(t_parser_state *state,
 		state->ast->syntax_error = SYNTAX_UNEXPECTED_TOKEN;
 		return (NULL);
 	}
+	redir_node->data.redirection.fd = get_redirection_fd(
+			state->tokens[state->index]);
 	state->index += 2;
 	return (redir_node);
 }
@@ -66,6 +68,11 @@ t_ast_node	*create_pipe_redirection(t_parser_state *state,
 /**
  * @brief Process redirections for a pipe command.
  * 
+ * The redirection nodes are chained in source order: the first one is
+ * returned and the last one wraps the command, like the chain built for
+ * the first command of the line. Words found after a redirection are
+ * appended to the command arguments.
+ * 
  * @param state Parser state.
  * @param right_node Command node to process redirections for.
  * @return Updated node after redirections processing.
@@ -73,18 +80,25 @@ t_ast_node	*create_pipe_redirection(t_parser_state *state,
 t_ast_node	*process_pipe_redirections(t_parser_state *state,
 	t_ast_node *right_node)
 {
+	t_ast_node	*head;
+	t_ast_node	*tail;
 	t_ast_node	*redir_node;
 
+	head = right_node;
+	tail = NULL;
 	while (state->tokens[state->index]
 		&& is_redirection_token(state->tokens[state->index]))
 	{
 		redir_node = create_pipe_redirection(state, right_node);
 		if (!redir_node)
 			return (NULL);
-		right_node = process_additional_args(state, right_node);
-		if (!right_node)
+		if (!process_additional_args(state, right_node))
 			return (NULL);
-		right_node = redir_node;
+		if (tail)
+			tail->data.redirection.child = redir_node;
+		else
+			head = redir_node;
+		tail = redir_node;
 	}
-	return (right_node);
+	return (head);
 }
@@ -29,11 +29,12 @@
  * @param token The token to be checked.
  * @return true if the token is a command group, false otherwise.
  * 
- * @note A command group is represented by parentheses.
+ * @note A command group is represented by parentheses. An arithmetic
+ * command `((expr))` is not one.
  */
 bool	is_command_group(const char *token)
 {
-	if (token && token[0] == '(')
+	if (token && token[0] == '(' && !is_arith_command(token))
 		return (true);
 	return (false);
 }
@@ -58,7 +59,9 @@ bool	is_pipe_token(const char *token)
  * @brief Checks if the given token is a redirection token.
  *
  * This function determines whether the provided token is a redirection token
- * (e.g., '>', '>>', '<', '<<') used in shell commands.
+ * (e.g., '>', '>>', '<', '<<', '<<<', '>&', '<&', '>|', '>^') used in shell
+ * commands, optionally preceded by a file descriptor number (e.g., '2>',
+ * '2>&').
  *
  * @param token The token to be checked.
  * @return true if the token is a redirection token, false otherwise.
@@ -67,13 +70,17 @@ bool	is_redirection_token(const char *token)
 {
 	if (!token)
 		return (false);
+	token = skip_fd_prefix(token);
+	if (ft_strcmp(token, ">&") == 0 || ft_strcmp(token, "<&") == 0)
+		return (true);
 	if (ft_strcmp(token, ">") == 0)
 		return (true);
 	if (ft_strcmp(token, "<") == 0)
 		return (true);
-	if (ft_strcmp(token, ">>") == 0)
+	if (ft_strcmp(token, ">>") == 0 || ft_strcmp(token, ">|") == 0
+		|| ft_strcmp(token, ">^") == 0)
 		return (true);
-	if (ft_strcmp(token, "<<") == 0)
+	if (ft_strcmp(token, "<<") == 0 || ft_strcmp(token, "<<<") == 0)
 		return (true);
 	return (false);
 }
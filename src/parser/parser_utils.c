@@ -92,7 +92,10 @@ void	handle_command_group(t_parser_state *state)
  *
  * This function takes a token as input and returns the corresponding
  * redirection type. The token is expected to be a string representing
- * a redirection operator (e.g., ">", ">>", "<", "<<").
+ * a redirection operator (e.g., ">", ">>", "<", "<<", "<<<", ">&", "<&",
+ * ">|", ">^").
+ * A file descriptor number before the operator is ignored here, see
+ * get_redirection_fd.
  *
  * @param token The token representing the redirection operator.
  * @return The type of redirection as a value of the t_redir_type enum.
@@ -102,15 +105,24 @@ void	handle_command_group(t_parser_state *state)
  */
 t_redir_type	get_redirection_type(const char *token)
 {
-	if (!token)
-	{
-		ft_error_msg(PARSER_ERR, "Invalid token in get_redirection_type");
-		return (REDIR_NONE);
-	}
+	if (token)
+		token = skip_fd_prefix(token);
+	else
+		token = "";
+	if (ft_strcmp(token, ">&") == 0)
+		return (REDIR_DUP_OUT);
+	else if (ft_strcmp(token, "<&") == 0)
+		return (REDIR_DUP_IN);
 	else if (ft_strcmp(token, "<<") == 0)
 		return (REDIR_HEREDOC);
+	else if (ft_strcmp(token, "<<<") == 0)
+		return (REDIR_HERESTRING);
 	else if (ft_strcmp(token, ">>") == 0)
 		return (REDIR_APPEND);
+	else if (ft_strcmp(token, ">|") == 0)
+		return (REDIR_CLOBBER);
+	else if (ft_strcmp(token, ">^") == 0)
+		return (REDIR_ATOMIC);
 	else if (ft_strcmp(token, ">") == 0)
 		return (REDIR_OUTPUT);
 	else if (ft_strcmp(token, "<") == 0)
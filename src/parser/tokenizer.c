@@ -10,124 +10,50 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "minishell.h"
 #include "parser/tokenizer_utils.h"
-#include "utils/print.h"
+#include "core/profile.h"
 
-bool	ft_isspace(char c);
-size_t	ft_strlen(const char *s);
-void	expand_tokens(char **tokens, size_t token_count, t_shell *shell);
-void	ft_error_msg(const char *prefix, const char *msg);
-bool	init_buffer(t_dynamic_buffer *buffer, size_t initial_capacity);
-void	free_buffer(t_dynamic_buffer *buffer);
-void	*safe_malloc(size_t size);
-bool	process_token(const char *input, int *i, t_dynamic_buffer *buffer,
-			t_tokenizer_state *state);
+void	adopt_glob_words(char ***tokens, size_t *count);
 
 /**
- * @brief Initializes the tokenizer state.
+ * @brief Copies the tokens of a lexed batch into a heap array.
  *
- * This function initializes the tokenizer state structure, allocating
- * memory for the tokens array and setting the token count to zero.
- *
- * @param input The input string to be tokenized.
- * @param token_count A pointer to an integer to store the token count.
- * @return A pointer to the newly initialized tokenizer state structure.
+ * The NULL that ends each line of the batch is skipped, so a newline in
+ * the input separates words like a blank.
  *
+ * @param batch The lexed batch.
+ * @param count Receives the number of tokens.
+ * @return The NULL-terminated array, or NULL on allocation failure.
  */
-static char	**init_tokenizer(const char *input, size_t *token_count)
+static char	**copy_batch_tokens(const t_batch *batch, size_t *count)
 {
 	char	**tokens;
-	size_t	max_tokens;
-
-	if (!input || !token_count)
-	{
-		ft_error_msg("minishell",
-			"Error: Invalid input or token count pointer");
-		return (NULL);
-	}
-	max_tokens = (ft_strlen(input) / 2) + 2;
-	tokens = safe_malloc(sizeof(char *) * max_tokens);
-	if (!tokens)
-	{
-		*token_count = 0;
-		ft_error_msg("init_tokenizer", "Error: Failed to allocate memory");
-		return (NULL);
-	}
-	*token_count = 0;
-	return (tokens);
-}
-
-/**
- * @brief Handles the tokenization of the input string.
- *
- * This function processes the input string character by character,
- * building tokens based on predefined rules and delimiters.
- *
- * @param input The input string to be tokenized.
- * @param state A pointer to the tokenizer state structure.
- * @param buffer A character buffer to store the current token.
- * @return void
- *
- */
-static bool	handle_tokenization(const char *input,
-	t_tokenizer_state *state, t_dynamic_buffer *buffer)
-{
-	int		i;
-	bool	success;
+	size_t	i;
 
+	tokens = safe_malloc(sizeof(char *) * (batch->token_count + 1));
+	*count = 0;
+	tokens[0] = NULL;
 	i = 0;
-	success = true;
-	while (input[i] && success)
+	while (i < batch->token_count)
 	{
-		success = process_token(input, &i, buffer, state);
+		if (batch->tokens[i])
+		{
+			tokens[*count] = ft_strdup(batch->tokens[i]);
+			if (!tokens[*count])
+				return (free_tokens_array(tokens, *count), NULL);
+			tokens[++(*count)] = NULL;
+		}
 		i++;
 	}
-	return (success);
-}
-
-static void	init_tokenizer_state(t_tokenizer_state *state)
-{
-	if (!state)
-		return ;
-	state->tokens = NULL;
-	state->token_count = 0;
-	state->buffer_index = 0;
-	state->quote = '\0';
-	return ;
-}
-
-/**
- * @brief Finalizes the tokenization process.
- * 
- * This function finalizes the tokenization process by handling the buffer,
- * updating the tokens array, and expanding tokens with environment variables.
- * 
- * @param state The tokenizer state.
- * @param buffer The dynamic buffer.
- * @param shell The shell structure.
- * @return True if tokenization was successful, false otherwise.
- */
-static bool	finalize_tokenization(t_tokenizer_state *state,
-	t_dynamic_buffer *buffer, t_shell *shell)
-{
-	if (!state->tokens)
-	{
-		free_buffer(buffer);
-		return (false);
-	}
-	handle_buffer(buffer->data, &buffer->size, state->tokens,
-		&state->token_count);
-	free_buffer(buffer);
-	state->tokens[state->token_count] = NULL;
-	expand_tokens(state->tokens, state->token_count, shell);
-	return (true);
+	return (tokens);
 }
 
 /**
  * @brief Tokenizes the input string into an array of tokens.
  * 
- * This function processes the input string, splitting it into tokens
- * based on the shell's environment and tokenization rules.
+ * The input is lexed by the batch lexer, the one the interactive loop and
+ * the script mode use, then its words are expanded.
  * 
  * @param input The input string to tokenize.
  * @param shell The shell structure.
@@ -137,22 +63,29 @@ static bool	finalize_tokenization(t_tokenizer_state *state,
  */
 char	**tokenize_input(const char *input, t_shell *shell)
 {
-	t_tokenizer_state	state;
-	t_dynamic_buffer	buffer;
-	bool				success;
+	t_batch		batch;
+	char		*line;
+	char		**tokens;
+	size_t		count;
+	uint64_t	start;
 
-	if (!shell)
+	if (!input || !shell)
 		return (NULL);
-	init_tokenizer_state(&state);
-	success = init_buffer(&buffer, BUFFER_CAPACITY);
-	if (!success)
+	line = duplicate_input(input);
+	if (!line)
 		return (NULL);
-	state.tokens = init_tokenizer(input, &state.token_count);
-	success = handle_tokenization(input, &state, &buffer);
-	if (!success || !finalize_tokenization(&state, &buffer, shell))
+	tokens = NULL;
+	if (tokenize_batch(line, &batch))
 	{
-		free_tokens_array(state.tokens, state.token_count);
-		return (NULL);
+		tokens = copy_batch_tokens(&batch, &count);
+		free_batch(&batch);
 	}
-	return (state.tokens);
+	safe_free((void **)&line);
+	if (!tokens)
+		return (NULL);
+	start = prof_start();
+	expand_tokens(&tokens, &count, shell);
+	adopt_glob_words(&tokens, &count);
+	prof_stop(PROF_EXPAND, start);
+	return (tokens);
 }
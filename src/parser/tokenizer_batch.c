@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tokenizer_batch.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:21:48 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:21:48 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file tokenizer_batch.c
+ * @brief Single-pass lexer for multi-line input.
+ * 
+ * The whole input (a pasted block or a script body) is split into tokens
+ * in one pass. Token strings are copied once into the batch arena and the
+ * newlines are replaced by NUL bytes, so every line can still be validated
+ * on its own. Words keep their quotes and no variable is expanded here:
+ * expansion happens line by line right before execution, so a line sees
+ * the variables set by the previous ones.
+ * 
+ * This lexer owns the splitting rules of the shell; tokenize_input is a
+ * wrapper over it that copies and expands the tokens of one string. A
+ * newline ends the line (and any open quote). A process substitution is
+ * one token, whatever it contains, and a command substitution is never
+ * split.
+ */
+
+#include "minishell.h"
+#include "core/arena.h"
+#include "core/profile.h"
+
+bool	ft_isspace(char c);
+
+/**
+ * @brief Ends the word being lexed, if any, and pushes it.
+ * 
+ * @param batch The batch.
+ * @param end The first byte after the word.
+ * @return False on allocation failure.
+ */
+static bool	flush_word(t_batch *batch, char *end)
+{
+	char	*word;
+
+	word = batch->word;
+	batch->word = NULL;
+	if (!word)
+		return (true);
+	return (batch_push_token(batch,
+			arena_strndup(&batch->arena, word, end - word)));
+}
+
+/**
+ * @brief Pushes a `<(list)` or `>(list)` token.
+ * 
+ * @param batch The batch.
+ * @param input The input.
+ * @param i Index of the `<` or `>`, moved to the closing parenthesis.
+ * @return False on allocation failure.
+ */
+static bool	lex_procsub(t_batch *batch, char *input, size_t *i)
+{
+	size_t	len;
+
+	if (!flush_word(batch, input + *i))
+		return (false);
+	len = procsub_len(input + *i);
+	*i += len - 1;
+	return (batch_push_token(batch,
+			arena_strndup(&batch->arena, input + *i + 1 - len, len)));
+}
+
+/**
+ * @brief Pushes a `|`, `<`, `>`, `<<`, `<<<`, `>>`, `<&` or `>&` token.
+ * 
+ * The word being lexed is pushed first, unless it is made of digits and
+ * right before a redirection operator: it is then the file descriptor
+ * prefix of the operator and becomes part of its token. A `<` or `>` that
+ * opens a process substitution is lexed with lex_procsub instead.
+ * 
+ * @param batch The batch.
+ * @param input The input.
+ * @param i Index of the operator, moved to its last character.
+ * @return False on allocation failure.
+ */
+static bool	lex_operator(t_batch *batch, char *input, size_t *i)
+{
+	char	*start;
+	size_t	len;
+
+	if (procsub_len(input + *i))
+		return (lex_procsub(batch, input, i));
+	start = input + *i;
+	if (input[*i] != '|' && batch->word
+		&& is_fd_prefix(batch->word, start - batch->word))
+	{
+		start = batch->word;
+		batch->word = NULL;
+	}
+	else if (!flush_word(batch, start))
+		return (false);
+	len = redirection_operator_len(input + *i);
+	*i += len - 1;
+	return (batch_push_token(batch,
+			arena_strndup(&batch->arena, start, input + *i + 1 - start)));
+}
+
+/**
+ * @brief Lexes one character of the input.
+ * 
+ * @param batch The batch.
+ * @param input The input.
+ * @param i Index of the character (moved past multi-character operators).
+ * @return False on allocation failure.
+ */
+static bool	lex_char(t_batch *batch, char *input, size_t *i)
+{
+	char	c;
+
+	c = input[*i];
+	if (c == '\n')
+	{
+		input[*i] = '\0';
+		return (flush_word(batch, input + *i)
+			&& batch_end_line(batch, input + *i + 1));
+	}
+	if (batch->quote)
+	{
+		if (c == batch->quote)
+			batch->quote = '\0';
+		return (true);
+	}
+	if (ft_isspace(c))
+		return (flush_word(batch, input + *i));
+	if (c == '|' || c == '<' || c == '>')
+		return (lex_operator(batch, input, i));
+	if (c == '\'' || c == '"')
+		batch->quote = c;
+	if (!batch->word)
+		batch->word = input + *i;
+	return (true);
+}
+
+/**
+ * @brief Splits a multi-line input into per-line token arrays.
+ * 
+ * @param input The input, modified in place (newlines become NUL bytes).
+ * @param batch The batch to fill, released with free_batch.
+ * @return False on allocation failure (the batch is then already freed).
+ */
+bool	tokenize_batch(char *input, t_batch *batch)
+{
+	size_t		i;
+	bool		ok;
+	uint64_t	start;
+
+	start = prof_start();
+	ok = batch_init(batch, input);
+	i = 0;
+	while (ok && input[i])
+	{
+		ok = lex_cmdsub(batch, input, &i) || lex_char(batch, input, &i);
+		i++;
+	}
+	if (ok)
+		ok = flush_word(batch, input + i) && batch_end_line(batch, NULL);
+	prof_stop(PROF_TOKENIZE, start);
+	if (!ok)
+	{
+		ft_error_msg(PARSER_ERR, "Failed to tokenize input");
+		free_batch(batch);
+	}
+	return (ok);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tokenizer_batch_utils.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:34:05 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 16:34:05 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file tokenizer_batch_utils.c
+ * @brief Storage of the batch lexer: token and line arrays.
+ * 
+ * Both arrays grow by doubling, so a batch of any size costs a logarithmic
+ * number of allocations. The token strings themselves live in the arena,
+ * whose first block is sized for the whole input.
+ */
+
+#include "minishell.h"
+#include "core/arena.h"
+
+void	*ft_realloc(void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Makes room for one more element in a growable array.
+ * 
+ * @param array Address of the array.
+ * @param used The number of elements in use.
+ * @param capacity Address of the capacity, doubled when full.
+ * @param elem_size The size of an element.
+ * @return False on allocation failure.
+ */
+static bool	reserve(void **array, size_t used, size_t *capacity,
+	size_t elem_size)
+{
+	void	*grown;
+
+	if (used < *capacity)
+		return (true);
+	grown = ft_realloc(*array, used * elem_size, *capacity * 2 * elem_size);
+	if (!grown)
+		return (false);
+	*array = grown;
+	*capacity *= 2;
+	return (true);
+}
+
+/**
+ * @brief Initializes a batch for the given input and opens its first line.
+ * 
+ * A token takes at most two bytes per input byte (a one-character operator
+ * and its NUL), so the first arena block always holds every token.
+ * 
+ * @param batch The batch.
+ * @param input The input to lex.
+ * @return False on allocation failure.
+ */
+bool	batch_init(t_batch *batch, char *input)
+{
+	size_t	len;
+
+	len = ft_strlen(input);
+	arena_init(&batch->arena, len * 2 + 1);
+	batch->token_count = 0;
+	batch->token_capacity = len / 4 + 16;
+	batch->tokens = safe_malloc(batch->token_capacity * sizeof(char *));
+	batch->line_count = 1;
+	batch->line_capacity = 16;
+	batch->lines = safe_malloc(batch->line_capacity * sizeof(t_batch_line));
+	batch->max_count = 0;
+	batch->word = NULL;
+	batch->quote = '\0';
+	if (!batch->tokens || !batch->lines)
+		return (false);
+	batch->lines[0].source = input;
+	batch->lines[0].first = 0;
+	batch->lines[0].count = 0;
+	return (true);
+}
+
+/**
+ * @brief Appends a token to the current line.
+ * 
+ * @param batch The batch.
+ * @param token The token (NULL if its copy failed).
+ * @return False on allocation failure.
+ */
+bool	batch_push_token(t_batch *batch, char *token)
+{
+	if (!token || !reserve((void **)&batch->tokens, batch->token_count,
+			&batch->token_capacity, sizeof(char *)))
+		return (false);
+	batch->tokens[batch->token_count++] = token;
+	return (true);
+}
+
+/**
+ * @brief Terminates the current line and opens the next one.
+ * 
+ * @param batch The batch.
+ * @param next The source of the next line, or NULL at the end of input.
+ * @return False on allocation failure.
+ */
+bool	batch_end_line(t_batch *batch, char *next)
+{
+	t_batch_line	*line;
+
+	if (!reserve((void **)&batch->tokens, batch->token_count,
+			&batch->token_capacity, sizeof(char *)))
+		return (false);
+	line = &batch->lines[batch->line_count - 1];
+	line->count = batch->token_count - line->first;
+	batch->tokens[batch->token_count++] = NULL;
+	if (line->count > batch->max_count)
+		batch->max_count = line->count;
+	batch->quote = '\0';
+	if (!next)
+		return (true);
+	if (!reserve((void **)&batch->lines, batch->line_count,
+			&batch->line_capacity, sizeof(t_batch_line)))
+		return (false);
+	line = &batch->lines[batch->line_count++];
+	line->source = next;
+	line->first = batch->token_count;
+	line->count = 0;
+	return (true);
+}
+
+/**
+ * @brief Releases a batch.
+ * 
+ * @param batch The batch.
+ */
+void	free_batch(t_batch *batch)
+{
+	arena_free(&batch->arena);
+	safe_free((void **)&batch->tokens);
+	safe_free((void **)&batch->lines);
+	batch->token_count = 0;
+	batch->line_count = 0;
+}
@@ -16,34 +16,149 @@
  */
 
 #include "types.h"
+#include "core/profile.h"
+#include "env/env_fields.h"
 
-char	*replace_env_variables(const char *token, t_shell *shell);
+char	*word_expand(const char *token, t_shell *shell);
 void	safe_free(void **ptr);
+char	*ft_strchr(const char *str, int c);
+bool	is_procsub_word(const char *token);
+void	*ft_memset(void *b, int c, size_t len);
+
+/**
+ * @brief Tells whether a token has anything to expand.
+ * 
+ * Only tokens containing a '$' or a '~', other than process substitutions,
+ * go through the expansion: the others expand to themselves. A process
+ * substitution is left as is: its list is expanded when it runs.
+ * 
+ * @param token The token.
+ * @return true if the token is expanded.
+ */
+static bool	token_expands(const char *token)
+{
+	return ((ft_strchr(token, '$') || ft_strchr(token, '~'))
+		&& !is_procsub_word(token));
+}
+
+/**
+ * @brief Appends the expansion of a token to the words of the line.
+ * 
+ * A token with nothing to expand is appended itself, the others as the
+ * fields they split into, or as a single expanded word (see word_splits).
+ * 
+ * @param tokens The tokens of the line.
+ * @param i The index of the token.
+ * @param out The words of the line.
+ * @param shell The shell structure.
+ * @return false on allocation failure.
+ */
+static bool	push_expansion(char **tokens, size_t i, t_str_vec *out,
+	t_shell *shell)
+{
+	char	*word;
+
+	if (!token_expands(tokens[i]))
+		return (str_vec_push(out, tokens[i]));
+	if (word_splits(tokens, i))
+		return (word_fields(tokens[i], shell, out));
+	word = word_expand(tokens[i], shell);
+	if (!str_vec_push(out, word))
+		return (free(word), false);
+	return (true);
+}
 
 /**
  * @brief Expands tokens by replacing environment variables.
  * 
- * This function iterates through an array of tokens, replacing any
- * environment variables found within each token with their corresponding
- * values from the environment variables list.
+ * This function expands the tokens of a line into a new array: a leading
+ * tilde and the environment variables found within each token are
+ * replaced, then the token is split into fields. The tokens that were
+ * replaced are freed.
  * 
- * @param tokens Array of tokens to process.
- * @param token_count Number of tokens in the array.
+ * @param tokens Array of tokens to process, replaced.
+ * @param token_count Number of tokens in the array, updated.
  * @param shell The shell structure.
  */
-void	expand_tokens(char **tokens, size_t token_count, t_shell *shell)
+void	expand_tokens(char ***tokens, size_t *token_count, t_shell *shell)
 {
-	size_t	i;
-	char	*expanded_token;
+	t_str_vec	out;
+	size_t		i;
 
 	if (!shell || !shell->env)
 		return ;
+	ft_memset(&out, 0, sizeof(t_str_vec));
+	i = 0;
+	while (i < *token_count)
+	{
+		if (!push_expansion(*tokens, i, &out, shell) || out.count == 0
+			|| out.items[out.count - 1] != (*tokens)[i])
+			safe_free((void **)&(*tokens)[i]);
+		i++;
+	}
+	*token_count = out.count;
+	if (!out.items)
+		return ;
+	free(*tokens);
+	*tokens = out.items;
+}
+
+/**
+ * @brief Expands the tokens of one batch line into a scratch array.
+ * 
+ * The tokens with nothing to expand are not copied: the scratch array
+ * points straight at the batch token. release_batch_line frees what was
+ * allocated here.
+ * 
+ * @param raw The tokens of the line, as lexed.
+ * @param count The number of tokens.
+ * @param line Scratch array, with room for at least one entry.
+ * @param shell The shell structure.
+ */
+void	expand_batch_line(char **raw, size_t count, t_str_vec *line,
+	t_shell *shell)
+{
+	size_t		i;
+	uint64_t	start;
+
+	start = prof_start();
+	line->count = 0;
+	line->items[0] = NULL;
+	i = 0;
+	while (i < count)
+	{
+		push_expansion(raw, i, line, shell);
+		i++;
+	}
+	prof_stop(PROF_EXPAND, start);
+}
+
+/**
+ * @brief Frees the tokens that expand_batch_line allocated.
+ * 
+ * The batch tokens left as is are in the scratch array in their order,
+ * and a token that was expanded is never there.
+ * 
+ * @param raw The tokens of the line, as lexed.
+ * @param count The number of tokens.
+ * @param line The expanded tokens.
+ */
+void	release_batch_line(char **raw, size_t count, t_str_vec *line)
+{
+	size_t	i;
+	size_t	j;
+
 	i = 0;
-	while (i < token_count)
+	j = 0;
+	while (i < line->count)
 	{
-		expanded_token = replace_env_variables(tokens[i], shell);
-		safe_free((void **)&tokens[i]);
-		tokens[i] = expanded_token;
+		while (j < count && token_expands(raw[j]))
+			j++;
+		if (j < count && line->items[i] == raw[j])
+			j++;
+		else
+			safe_free((void **)&line->items[i]);
 		i++;
 	}
+	line->count = 0;
 }
@@ -30,6 +30,8 @@
  * standard input file descriptor to terminate the heredoc process.
  * 
  * ### Key Operations:
+ * - Records the interruption in `g_signal_state`, so that the reader
+ *   can tell it from an end of file.
  * - Writes a newline to `STDERR_FILENO` for prompt clarity.
  * - Closes the standard input file descriptor to terminate heredoc.
  * 
@@ -42,6 +44,7 @@
 void	sigint_heredoc_handler(int sig)
 {
 	(void)sig;
+	g_signal_state |= SIG_INT;
 	write(STDERR_FILENO, "\n", 1);
 	close(STDIN_FILENO);
 }
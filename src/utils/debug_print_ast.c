@@ -45,6 +45,16 @@ char	*print_redirection_type(t_redir_type *redirection)
 		return (">>");
 	if (*redirection == REDIR_HEREDOC)
 		return ("<<");
+	if (*redirection == REDIR_HERESTRING)
+		return ("<<<");
+	if (*redirection == REDIR_DUP_IN)
+		return ("<&");
+	if (*redirection == REDIR_DUP_OUT)
+		return (">&");
+	if (*redirection == REDIR_CLOBBER)
+		return (">|");
+	if (*redirection == REDIR_ATOMIC)
+		return (">^");
 	if (*redirection == REDIR_NONE)
 		return ("NONE");
 	return ("UNDEFINED");
@@ -44,6 +44,11 @@ void	print_redirection_node(t_ast_node *node, int depth)
 	print_indentation(depth);
 	printf("Redirection type: %s\n",
 		print_redirection_type(&node->data.redirection.type));
+	if (node->data.redirection.fd != -1)
+	{
+		print_indentation(depth);
+		printf("Redirection fd: %d\n", node->data.redirection.fd);
+	}
 	print_indentation(depth);
 	if (node->data.redirection.file)
 		printf("Redirection file: %s\n", node->data.redirection.file);
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:12:40 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 18:12:40 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file glob_match.c
+ * @brief Shell pattern matching.
+ * 
+ * `*` matches any string, `?` any character and `[...]` one character of
+ * a set (ranges like `a-z`, negated by a leading `!` or `^`). A backslash
+ * makes the next character literal. The part before the first `*` is
+ * matched directly; a `*` then tries the rest of the pattern at every
+ * position left.
+ */
+
+#include "minishell.h"
+#include "utils/glob_match.h"
+
+/**
+ * @brief Matches a character against the `[...]` set at pattern.
+ * 
+ * @param pattern The pattern, at the `[`.
+ * @param c The character.
+ * @param matched Receives whether c is in the set.
+ * @return The length of the set, or 0 if the `[` is not closed (and is
+ * then an ordinary character).
+ */
+static size_t	match_class(const char *pattern, char c, bool *matched)
+{
+	size_t	i;
+	bool	negate;
+
+	i = 1;
+	negate = (pattern[i] == '!' || pattern[i] == '^');
+	i += negate;
+	*matched = false;
+	while (pattern[i] && (pattern[i] != ']' || i == 1 + (size_t)negate))
+	{
+		if (pattern[i] == '\\' && pattern[i + 1])
+			i++;
+		if (pattern[i + 1] == '-' && pattern[i + 2] && pattern[i + 2] != ']')
+		{
+			*matched |= (c >= pattern[i] && c <= pattern[i + 2]);
+			i += 2;
+		}
+		else
+			*matched |= (pattern[i] == c);
+		i++;
+	}
+	if (!pattern[i])
+		return (0);
+	*matched ^= negate;
+	return (i + 1);
+}
+
+/**
+ * @brief Matches one character against the element at pattern.
+ * 
+ * @param pattern The pattern, not at a `*`.
+ * @param c The character.
+ * @return The length of the element if it matches c, 0 otherwise.
+ */
+static size_t	match_one(const char *pattern, char c)
+{
+	size_t	len;
+	bool	matched;
+
+	if (*pattern == '\0')
+		return (0);
+	if (*pattern == '?')
+		return (1);
+	if (*pattern == '[')
+	{
+		len = match_class(pattern, c, &matched);
+		if (len > 0 && matched)
+			return (len);
+		if (len > 0)
+			return (0);
+	}
+	if (*pattern == '\\' && pattern[1])
+		return (2 * (pattern[1] == c));
+	return (*pattern == c);
+}
+
+/**
+ * @brief Tells whether the first len characters of str match a pattern.
+ * 
+ * @param pattern The pattern, NUL-terminated.
+ * @param str The string.
+ * @param len The number of characters of str to match.
+ * @return true if the whole of them match.
+ */
+bool	glob_match(const char *pattern, const char *str, size_t len)
+{
+	size_t	i;
+	size_t	step;
+
+	i = 0;
+	while (*pattern != '*')
+	{
+		if (i == len)
+			return (*pattern == '\0');
+		step = match_one(pattern, str[i]);
+		if (step == 0)
+			return (false);
+		pattern += step;
+		i++;
+	}
+	while (*pattern == '*')
+		pattern++;
+	if (*pattern == '\0')
+		return (true);
+	while (i < len)
+	{
+		if (glob_match(pattern, str + i, len - i))
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Turns a word into a pattern: its quotes are removed and the
+ * characters they protected are escaped, so only unquoted `*`, `?` and
+ * `[` are special.
+ * 
+ * @param word The word, with its quotes.
+ * @return The pattern, to be freed, or NULL on allocation failure.
+ */
+char	*pattern_from_word(const char *word)
+{
+	char	*pattern;
+	char	quote;
+	size_t	j;
+
+	pattern = safe_malloc(ft_strlen(word) * 2 + 1);
+	if (!pattern)
+		return (NULL);
+	quote = '\0';
+	j = 0;
+	while (*word)
+	{
+		if (!quote && (*word == '\'' || *word == '"'))
+			quote = *word;
+		else if (quote && *word == quote)
+			quote = '\0';
+		else
+		{
+			if (quote && ft_strchr("*?[]\\", *word))
+				pattern[j++] = '\\';
+			pattern[j++] = *word;
+		}
+		word++;
+	}
+	pattern[j] = '\0';
+	return (pattern);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   num_print_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yagoairm2 <yagoairm2@student.42.fr>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:02:11 by yagoairm2         #+#    #+#             */
+/*   Updated: 2026/10/18 10:02:11 by yagoairm2        ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file num_print_utils.c
+ * @brief Allocation-free helpers to print integers on a file descriptor.
+ *
+ * These helpers format the number into a small stack buffer and emit it
+ * with a single write, so they can be used by the reporting code (time
+ * keyword, statistics) without going through ft_itoa.
+ */
+
+#include "utils/print.h"
+
+/**
+ * @brief Formats a non-negative number right-aligned into a buffer.
+ *
+ * @param n The number to format (must be non-negative).
+ * @param buf The buffer, at least NUM_PRINT_MAX bytes long.
+ * @param width Minimum number of digits, padded with zeros.
+ * @return The index of the first digit in the buffer.
+ */
+static int	format_unsigned(unsigned long long n, char *buf, int width)
+{
+	int	i;
+
+	i = NUM_PRINT_MAX;
+	if (n == 0)
+		buf[--i] = '0';
+	while (n > 0)
+	{
+		buf[--i] = '0' + (n % 10);
+		n /= 10;
+	}
+	while (NUM_PRINT_MAX - i < width && i > 1)
+		buf[--i] = '0';
+	return (i);
+}
+
+/**
+ * @brief Writes a number padded with leading zeros to a file descriptor.
+ *
+ * @param n The number to write.
+ * @param width Minimum number of digits (0 for no padding).
+ * @param fd The file descriptor to write to.
+ */
+void	ft_putnbr_pad_fd(long long n, int width, int fd)
+{
+	char				buf[NUM_PRINT_MAX];
+	unsigned long long	value;
+	int					i;
+
+	value = (unsigned long long)n;
+	if (n < 0)
+		value = -(unsigned long long)n;
+	i = format_unsigned(value, buf, width);
+	if (n < 0)
+		buf[--i] = '-';
+	write(fd, buf + i, NUM_PRINT_MAX - i);
+}
+
+/**
+ * @brief Writes a number to a file descriptor.
+ *
+ * @param n The number to write.
+ * @param fd The file descriptor to write to.
+ */
+void	ft_putnbr_fd(long long n, int fd)
+{
+	ft_putnbr_pad_fd(n, 0, fd);
+}
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Script-mode regression cases.
+#
+# usage: run.sh <minishell binary>
+#
+# Runs every tests/*.msh in a scratch directory and compares its combined
+# stdout and stderr, followed by an rc=N line with the exit status of the
+# shell, with the matching .out file.
+
+BIN=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+HERE=$(cd "$(dirname "$0")" && pwd)
+FAILED=0
+for CASE in "$HERE"/*.msh; do
+	NAME=$(basename "$CASE" .msh)
+	SCRATCH=$(mktemp -d /tmp/minishell_check.XXXXXX)
+	(cd "$SCRATCH" && "$BIN" "$CASE" > "$SCRATCH/.actual" 2>&1)
+	echo "rc=$?" >> "$SCRATCH/.actual"
+	if diff -u "$HERE/$NAME.out" "$SCRATCH/.actual"; then
+		printf "ok   %s\n" "$NAME"
+	else
+		printf "FAIL %s\n" "$NAME"
+		FAILED=1
+	fi
+	rm -rf "$SCRATCH"
+done
+exit $FAILED